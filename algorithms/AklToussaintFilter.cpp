@@ -0,0 +1,85 @@
+#include "AklToussaintFilter.h"
+#include "Orientation.h"
+
+AklToussaintFilter::AklToussaintFilter(int directions)
+    : m_directions(directions == 4 ? 4 : 8) {}
+
+// One pass over the input to find the extreme point in every direction.
+// They are stored by outward normal in counterclockwise order, which makes the
+// polygon counterclockwise as well.
+void AklToussaintFilter::buildPolygon(const std::vector<Point>& points) {
+    size_t left = 0, bottom = 0, right = 0, top = 0;
+    size_t minSum = 0, maxDiff = 0, maxSum = 0, minDiff = 0;
+
+    for (size_t i = 1; i < points.size(); ++i) {
+        const Point& p = points[i];
+        if (p.x < points[left].x) left = i;
+        if (p.x > points[right].x) right = i;
+        if (p.y < points[bottom].y) bottom = i;
+        if (p.y > points[top].y) top = i;
+        if (p.x + p.y < points[minSum].x + points[minSum].y) minSum = i;
+        if (p.x + p.y > points[maxSum].x + points[maxSum].y) maxSum = i;
+        if (p.x - p.y < points[minDiff].x - points[minDiff].y) minDiff = i;
+        if (p.x - p.y > points[maxDiff].x - points[maxDiff].y) maxDiff = i;
+    }
+
+    std::vector<size_t> extremes;
+    if (m_directions == 8) {
+        extremes = {left, minSum, bottom, maxDiff, right, maxSum, top, minDiff};
+    } else {
+        extremes = {left, bottom, right, top};
+    }
+
+    // The same point can be extreme in several directions
+    m_polygon.clear();
+    for (size_t idx : extremes) {
+        const Point& p = points[idx];
+        if (m_polygon.empty() || !(m_polygon.back() == p)) {
+            m_polygon.push_back(p);
+        }
+    }
+    while (m_polygon.size() > 1 && m_polygon.back() == m_polygon.front()) {
+        m_polygon.pop_back();
+    }
+}
+
+std::vector<Point> AklToussaintFilter::apply(const std::vector<Point>& points) {
+    m_culled = 0;
+    m_polygon.clear();
+    if (points.size() < 4) return points;
+
+    buildPolygon(points);
+    if (m_polygon.size() < 3) return points;
+
+    // Edge i goes from (vx[i], vy[i]) by (ex[i], ey[i]); a point is inside if it is
+    // strictly left of every edge. Only results above the float error bound count, so
+    // points the float test cannot certify are kept and the culling loop stays vectorizable.
+    const size_t m = m_polygon.size();
+    float vx[8], vy[8], ex[8], ey[8];
+    for (size_t i = 0; i < m; ++i) {
+        const Point& a = m_polygon[i];
+        const Point& b = m_polygon[(i + 1) % m];
+        vx[i] = a.x;
+        vy[i] = a.y;
+        ex[i] = b.x - a.x;
+        ey[i] = b.y - a.y;
+    }
+
+    // Branch-free streaming pass: every point is written, the cursor only advances for survivors
+    std::vector<Point> result(points.size());
+    size_t count = 0;
+    for (const Point& p : points) {
+        bool inside = true;
+        for (size_t i = 0; i < m; ++i) {
+            const float left = ex[i] * (p.y - vy[i]);
+            const float right = ey[i] * (p.x - vx[i]);
+            inside &= left - right > Orientation::errorBound(left, right);
+        }
+        result[count] = p;
+        count += inside ? 0 : 1;
+    }
+
+    result.resize(count);
+    m_culled = points.size() - count;
+    return result;
+}
@@ -0,0 +1,31 @@
+#ifndef AKLTOUSSAINTFILTER_H
+#define AKLTOUSSAINTFILTER_H
+
+#include <cstddef>
+#include <vector>
+#include "point_providers/Point.h"
+
+// Akl–Toussaint heuristic: the extreme points in 4 or 8 directions span a convex
+// polygon inside the hull, so every point strictly inside that polygon can be
+// dropped before running a hull algorithm. Boundary points are always kept.
+class AklToussaintFilter {
+public:
+    explicit AklToussaintFilter(int directions = 8);
+
+    // Returns the surviving points in their original order
+    std::vector<Point> apply(const std::vector<Point>& points);
+
+    int getDirections() const { return m_directions; }
+    size_t getCulledCount() const { return m_culled; }
+    // Vertices of the filter polygon of the last apply() call, counterclockwise
+    const std::vector<Point>& getPolygon() const { return m_polygon; }
+
+private:
+    int m_directions;
+    size_t m_culled = 0;
+    std::vector<Point> m_polygon;
+
+    void buildPolygon(const std::vector<Point>& points);
+};
+
+#endif //AKLTOUSSAINTFILTER_H
@@ -1,14 +1,39 @@
 #include "AndrewAlgorithm.h"
+#include "Orientation.h"
+#include "ParallelSort.h"
+#include "RadixSort.h"
 #include <iostream>
+#include <limits>
 
-constexpr double EPS = 1e-9;
+// Parallel mode: inputs below this size use the serial path,
+// inputs above BLOCK_CUTOFF build per-block chains that are merged afterwards
+constexpr size_t PARALLEL_CUTOFF = 1 << 12;
+constexpr size_t BLOCK_CUTOFF = 1 << 18;
+// Radix mode: below this size the fixed cost of the radix passes loses to the comparison sort
+constexpr size_t RADIX_CUTOFF = 1 << 12;
 
-AndrewAlgorithm::AndrewAlgorithm(const std::vector<Point>& points) {
-    AndrewAlgorithm::reset(points);
+// A function object rather than a function pointer, so std::sort inlines the comparison
+struct LessXY {
+    template <class T>
+    bool operator()(const BasicPoint<T>& a, const BasicPoint<T>& b) const {
+        return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+    }
+};
+constexpr LessXY lessXY;
+
+template <class T>
+BasicAndrewAlgorithm<T>::BasicAndrewAlgorithm(const std::vector<PointType>& points) {
+    BasicAndrewAlgorithm::reset(points);
+}
+
+template <class T>
+void BasicAndrewAlgorithm<T>::reset(const std::vector<PointType>& points) {
+    load(points);
 }
 
-void AndrewAlgorithm::reset(const std::vector<Point>& points) {
-    m_points = points;
+template <class T>
+void BasicAndrewAlgorithm<T>::load(std::span<const PointType> points) {
+    m_points.assign(points.begin(), points.end());
     m_hull.clear();
     m_upper.clear();
     m_lower.clear();
@@ -17,24 +42,34 @@ void AndrewAlgorithm::reset(const std::vector<Point>& points) {
     m_phase = Phase::UPPER;
     m_hasCurrentPoint = false;
 
-    std::sort(m_points.begin(), m_points.end(), [](const Point& a, const Point& b) {
-        return (a.x < b.x) || (a.x == b.x && a.y < b.y);
-    });
+    if (m_sortMode == SortMode::RADIX && m_points.size() >= RADIX_CUTOFF) {
+        radixSortPoints(m_points, m_scratch, m_pool.get());
+    } else {
+        sortPoints(m_points);
+    }
+}
+
+template <class T>
+void BasicAndrewAlgorithm<T>::sortPoints(std::vector<PointType>& points) {
+    std::sort(points.begin(), points.end(), lessXY);
 }
 
 
-float AndrewAlgorithm::crossProduct(const Point& O, const Point& A, const Point& B) {
-    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+template <class T>
+typename BasicAndrewAlgorithm<T>::Cross BasicAndrewAlgorithm<T>::crossProduct(const PointType& O, const PointType& A, const PointType& B) {
+    return Orientation::cross(O, A, B);
 }
 
-void AndrewAlgorithm::addPointToChain(std::vector<Point>& chain, const Point& p) {
-    while (chain.size() >= 2 && crossProduct(chain[chain.size()-2], chain.back(), p) <= EPS) {
+template <class T>
+void BasicAndrewAlgorithm<T>::addPointToChain(std::vector<PointType>& chain, const PointType& p) {
+    while (chain.size() >= 2 && crossProduct(chain[chain.size()-2], chain.back(), p) <= 0) {
         chain.pop_back();
     }
     chain.push_back(p);
 }
 
-bool AndrewAlgorithm::step() {
+template <class T>
+bool BasicAndrewAlgorithm<T>::step() {
     if (m_finished) {
         m_hasCurrentPoint = false;
         return false;
@@ -74,16 +109,18 @@ bool AndrewAlgorithm::step() {
     return false;
 }
 
-bool AndrewAlgorithm::isFinished() const {
+template <class T>
+bool BasicAndrewAlgorithm<T>::isFinished() const {
     return m_finished;
 }
 
-std::vector<Point> AndrewAlgorithm::getCurrentHull() {
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::getCurrentHull() {
     if (m_phase == Phase::UPPER) {
         return m_upper;
     }
     if (m_phase == Phase::LOWER) {
-        std::vector<Point> current = m_upper;
+        std::vector<PointType> current = m_upper;
         for (size_t i = 0; i < m_lower.size(); i++) {
             current.push_back(m_lower[i]);
         }
@@ -92,8 +129,226 @@ std::vector<Point> AndrewAlgorithm::getCurrentHull() {
     return m_hull;
 }
 
-std::vector<Point> AndrewAlgorithm::runCompleteAlgorithm(const std::vector<Point>& points) {
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::runCompleteAlgorithm(const std::vector<PointType>& points) {
+    if (m_pool && points.size() >= PARALLEL_CUTOFF) {
+        return runParallel(points);
+    }
     reset(points);
     while (step()) {}
     return m_hull;
-}
\ No newline at end of file
+}
+
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::runCompleteAlgorithm(const PointSoA& points)
+    requires std::is_same_v<T, float> {
+    return runCompleteAlgorithm(points.toPoints());
+}
+
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::runCompleteAlgorithm(std::span<const PointType> points) {
+    if (m_pool && points.size() >= PARALLEL_CUTOFF) {
+        return runParallel(points);
+    }
+    load(points);
+    while (step()) {}
+    return m_hull;
+}
+
+// Both chains with a single stack: the second one starts at the last sorted point, which
+// already ends the first, and never pops below it. Its final point is the first vertex
+// again and is dropped. E is a point or an indexed point, pointOf reads its coordinates.
+template <class E, class PointOf>
+static void buildHull(const std::vector<E>& sorted, std::vector<E>& hull, PointOf pointOf) {
+    auto cross = [&](const E& p) {
+        return Orientation::cross(pointOf(hull[hull.size() - 2]), pointOf(hull.back()), pointOf(p));
+    };
+
+    hull.clear();
+    for (const E& p : sorted) {
+        while (hull.size() >= 2 && cross(p) <= 0) {
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+
+    const size_t base = hull.size();
+    for (size_t i = sorted.size(); i > 1; --i) {
+        const E& p = sorted[i - 2];
+        while (hull.size() > base && cross(p) <= 0) {
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+    if (hull.size() > base) {
+        hull.pop_back();
+    }
+}
+
+template <class T>
+void BasicAndrewAlgorithm<T>::computeHull(std::span<const PointType> points, std::vector<PointType>& hull,
+                                          Workspace& workspace) {
+    std::vector<PointType>& sorted = workspace.sorted;
+    sorted.assign(points.begin(), points.end());
+    sortPoints(sorted);
+    buildHull(sorted, hull, [](const PointType& p) -> const PointType& { return p; });
+}
+
+template <class T>
+bool BasicAndrewAlgorithm<T>::computeHullIndices(std::span<const PointType> points, std::vector<std::uint32_t>& hull,
+                                                 Workspace& workspace) {
+    hull.clear();
+    if (points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    std::vector<IndexedPoint>& indexed = workspace.indexed;
+    indexed.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        indexed[i] = {points[i], static_cast<std::uint32_t>(i)};
+    }
+    // The index breaks ties, so equal points always report the same one
+    std::sort(indexed.begin(), indexed.end(), [](const IndexedPoint& a, const IndexedPoint& b) {
+        return lessXY(a.point, b.point) || (a.point == b.point && a.index < b.index);
+    });
+
+    buildHull(indexed, workspace.chain, [](const IndexedPoint& e) -> const PointType& { return e.point; });
+    for (const IndexedPoint& e : workspace.chain) {
+        hull.push_back(e.index);
+    }
+    return true;
+}
+
+template <class T>
+void BasicAndrewAlgorithm<T>::setThreadCount(unsigned threadCount) {
+    if (threadCount <= 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != threadCount) {
+        m_pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+}
+
+// Joins two chains whose points are consecutive in the sort order. The bridge is found
+// by walking back from the end of the left chain and forward from the start of the
+// right chain until both turns at the tangent points are strictly convex.
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::mergeChains(const std::vector<PointType>& left, const std::vector<PointType>& right) {
+    if (left.empty()) return right;
+    if (right.empty()) return left;
+
+    size_t i = left.size() - 1;
+    size_t j = 0;
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        while (i > 0 && crossProduct(left[i - 1], left[i], right[j]) <= 0) {
+            --i;
+            moved = true;
+        }
+        while (j + 1 < right.size() && crossProduct(left[i], right[j], right[j + 1]) <= 0) {
+            ++j;
+            moved = true;
+        }
+    }
+
+    std::vector<PointType> merged(left.begin(), left.begin() + i + 1);
+    merged.insert(merged.end(), right.begin() + j, right.end());
+    return merged;
+}
+
+// Builds m_upper and m_lower from the sorted m_points on the pool
+template <class T>
+void BasicAndrewAlgorithm<T>::buildChainsParallel() {
+    WorkStealingPool& pool = *m_pool;
+    const size_t n = m_points.size();
+
+    if (n < BLOCK_CUTOFF) {
+        // Upper and lower chain are independent, build them concurrently
+        WorkStealingPool::TaskGroup group(pool);
+        group.run([&] {
+            for (size_t i = 0; i < n; ++i) addPointToChain(m_upper, m_points[i]);
+        });
+        for (size_t i = n; i-- > 0;) addPointToChain(m_lower, m_points[i]);
+        group.wait();
+        return;
+    }
+
+    // Per-block chains: the upper chain of a block is built left to right,
+    // the lower one right to left, exactly as in the serial algorithm
+    const size_t blocks = std::max<size_t>(2, pool.getThreadCount());
+    std::vector<std::vector<PointType>> upper(blocks);
+    std::vector<std::vector<PointType>> lower(blocks);
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        for (size_t b = 0; b < blocks; ++b) {
+            const size_t begin = n * b / blocks;
+            const size_t end = n * (b + 1) / blocks;
+            group.run([&, b, begin, end] {
+                for (size_t i = begin; i < end; ++i) addPointToChain(upper[b], m_points[i]);
+            });
+            group.run([&, b, begin, end] {
+                for (size_t i = end; i-- > begin;) addPointToChain(lower[b], m_points[i]);
+            });
+        }
+        group.wait();
+    }
+
+    // Pairwise merge rounds; the lower chains run right to left, so their merge order is reversed
+    while (upper.size() > 1) {
+        const size_t pairs = (upper.size() + 1) / 2;
+        std::vector<std::vector<PointType>> nextUpper(pairs);
+        std::vector<std::vector<PointType>> nextLower(pairs);
+        {
+            WorkStealingPool::TaskGroup group(pool);
+            for (size_t k = 0; k < pairs; ++k) {
+                group.run([&, k] {
+                    if (2 * k + 1 < upper.size()) {
+                        nextUpper[k] = mergeChains(upper[2 * k], upper[2 * k + 1]);
+                        nextLower[k] = mergeChains(lower[2 * k + 1], lower[2 * k]);
+                    } else {
+                        nextUpper[k] = std::move(upper[2 * k]);
+                        nextLower[k] = std::move(lower[2 * k]);
+                    }
+                });
+            }
+            group.wait();
+        }
+        upper = std::move(nextUpper);
+        lower = std::move(nextLower);
+    }
+
+    m_upper = std::move(upper.front());
+    m_lower = std::move(lower.front());
+}
+
+template <class T>
+std::vector<BasicPoint<T>> BasicAndrewAlgorithm<T>::runParallel(std::span<const PointType> points) {
+    m_points.assign(points.begin(), points.end());
+    m_upper.clear();
+    m_lower.clear();
+    m_hull.clear();
+    m_hasCurrentPoint = false;
+
+    if (m_sortMode == SortMode::RADIX && m_points.size() >= RADIX_CUTOFF) {
+        radixSortPoints(m_points, m_scratch, m_pool.get());
+    } else {
+        parallelSort(m_points, lessXY, *m_pool);
+    }
+    buildChainsParallel();
+
+    m_hull = m_upper;
+    for (size_t i = 1; i + 1 < m_lower.size(); i++) {
+        m_hull.push_back(m_lower[i]);
+    }
+    m_index = m_points.size();
+    m_phase = Phase::DONE;
+    m_finished = true;
+    return m_hull;
+}
+
+template class BasicAndrewAlgorithm<float>;
+template class BasicAndrewAlgorithm<double>;
+#ifdef __SIZEOF_INT128__
+template class BasicAndrewAlgorithm<std::int32_t>;
+template class BasicAndrewAlgorithm<std::int64_t>;
+#endif
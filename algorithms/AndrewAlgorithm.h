@@ -1,43 +1,106 @@
-
 #ifndef ANDREWALGORITHM_H
 #define ANDREWALGORITHM_H
 
 #include "IAlgorithm.h"
+#include "Orientation.h"
+#include "WorkStealingPool.h"
+#include "point_providers/PointSoA.h"
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <set>
+#include <span>
+#include <type_traits>
 
-class AndrewAlgorithm : public IAlgorithm {
+// Andrew's monotone chain over points with coordinates of type T. The member definitions
+// live in AndrewAlgorithm.cpp, which instantiates float, double, int32 and int64 (the
+// integer ones only where Orientation has its 128-bit predicate).
+template <class T>
+class BasicAndrewAlgorithm : public BasicIAlgorithm<T> {
 public:
-    explicit AndrewAlgorithm(const std::vector<Point>& points);
+    using PointType = BasicPoint<T>;
+    using IndexedPoint = BasicIndexedPoint<T>;
+    using Cross = CrossType<T>;
+
+    explicit BasicAndrewAlgorithm(const std::vector<PointType>& points);
 
     bool step() override;
-    std::vector<Point> getCurrentHull() override;
-    void reset(const std::vector<Point>& points) override;
+    std::vector<PointType> getCurrentHull() override;
+    void reset(const std::vector<PointType>& points) override;
     bool isFinished() const override; // needed for render() in App.cpp only
-    std::vector<Point> runCompleteAlgorithm(const std::vector<Point>& points) override;
+    std::vector<PointType> runCompleteAlgorithm(const std::vector<PointType>& points) override;
+    // The chain walk is a dependent stack, so structure-of-arrays input is gathered first
+    std::vector<PointType> runCompleteAlgorithm(const PointSoA& points) requires std::is_same_v<T, float>;
+    // Sorting needs a private copy, which is made straight from the span
+    std::vector<PointType> runCompleteAlgorithm(std::span<const PointType> points);
+
+    // Scratch storage of computeHull and computeHullIndices, kept by the caller between calls
+    struct Workspace {
+        std::vector<PointType> sorted;
+        std::vector<IndexedPoint> indexed;
+        std::vector<IndexedPoint> chain;
+    };
+
+    // Same hull as runCompleteAlgorithm, written to a caller-owned buffer. The sorted copy
+    // lives in the workspace and both chains are built in place in hull, so once the two
+    // vectors have grown to the input size a call does no heap allocation.
+    static void computeHull(std::span<const PointType> points, std::vector<PointType>& hull,
+                            Workspace& workspace);
+    // Index mode: hull[k] is the position in points of the k-th vertex of computeHull's
+    // result. The sort moves compact (point, index) pairs, never the caller's records; of
+    // several equal input points one index is reported. Returns false, with hull empty,
+    // for inputs too large for 32-bit indices.
+    static bool computeHullIndices(std::span<const PointType> points, std::vector<std::uint32_t>& hull,
+                                   Workspace& workspace);
 
     // Visualization methods
-    Point getCurrentPoint() const { return m_currentPoint; }
+    PointType getCurrentPoint() const { return m_currentPoint; }
     bool hasCurrentPoint() const { return m_hasCurrentPoint; }
     enum class Phase { UPPER, LOWER, DONE };
     Phase getPhase() const { return m_phase; }
 
+    // Parallel mode for runCompleteAlgorithm; 1 (the default) keeps the serial path
+    void setThreadCount(unsigned threadCount);
+    unsigned getThreadCount() const { return m_pool ? m_pool->getThreadCount() : 1; }
+
+    // Input ordering of the stepwise and complete runs. RADIX is the LSD radix sort of
+    // RadixSort.h for inputs of 4096 points and more, with its histogram pass on the pool
+    // when a thread count is set; smaller inputs keep the comparison sort.
+    enum class SortMode { COMPARISON, RADIX };
+    void setSortMode(SortMode mode) { m_sortMode = mode; }
+    SortMode getSortMode() const { return m_sortMode; }
+
+    // Kernels of the serial path, public for the micro benchmarks
+    static void sortPoints(std::vector<PointType>& points);
+    static void addPointToChain(std::vector<PointType>& chain, const PointType& p);
+    // Orientation predicate of the chains: > 0 is a strict left turn O -> A -> B (exact sign)
+    static Cross crossProduct(const PointType& O, const PointType& A, const PointType& B);
+
 private:
-    std::vector<Point> m_points;
-    std::vector<Point> m_upper;
-    std::vector<Point> m_lower;
-    std::vector<Point> m_hull;
+    std::vector<PointType> m_points;
+    std::vector<PointType> m_upper;
+    std::vector<PointType> m_lower;
+    std::vector<PointType> m_hull;
 
     size_t m_index;
     bool m_finished;
     Phase m_phase;
 
-    static float crossProduct(const Point& O, const Point& A, const Point& B);
     // Visualization state
-    Point m_currentPoint;
+    PointType m_currentPoint;
     bool m_hasCurrentPoint;
 
-    void addPointToChain(std::vector<Point>& chain, const Point& p);
+    std::unique_ptr<WorkStealingPool> m_pool;
+    SortMode m_sortMode = SortMode::COMPARISON;
+    std::vector<PointType> m_scratch; // second buffer of the radix sort
+
+    void load(std::span<const PointType> points);
+
+    static std::vector<PointType> mergeChains(const std::vector<PointType>& left, const std::vector<PointType>& right);
+    void buildChainsParallel();
+    std::vector<PointType> runParallel(std::span<const PointType> points);
 };
 
-#endif //ANDREWALGORITHM_H
\ No newline at end of file
+using AndrewAlgorithm = BasicAndrewAlgorithm<float>;
+
+#endif //ANDREWALGORITHM_H
@@ -0,0 +1,123 @@
+#include "BatchHull.h"
+#include "AndrewAlgorithm.h"
+#include <algorithm>
+
+// Points handed to one task; tiny sets are grouped so the task overhead stays small
+constexpr size_t TASK_POINTS = 1 << 14;
+
+static bool lessXY(const Point& a, const Point& b) {
+    return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+}
+
+// Per-thread working memory: a sorted copy of the current set and the chain stack
+struct Scratch {
+    std::vector<Point> sorted;
+    std::vector<Point> chain;
+};
+
+static Scratch& threadScratch() {
+    thread_local Scratch scratch;
+    return scratch;
+}
+
+// Andrew's monotone chain on one set, both chains in a single stack: the second chain
+// starts on the last point of the first one. Writes the hull to out (room for set.size()
+// points) and returns its size.
+static size_t buildHull(std::span<const Point> set, Scratch& scratch, Point* out) {
+    const size_t n = set.size();
+    if (n <= 1) {
+        std::copy(set.begin(), set.end(), out);
+        return n;
+    }
+
+    scratch.sorted.assign(set.begin(), set.end());
+    std::sort(scratch.sorted.begin(), scratch.sorted.end(), lessXY);
+    const Point* p = scratch.sorted.data();
+
+    if (scratch.chain.size() < n + 1) {
+        scratch.chain.resize(n + 1);
+    }
+    Point* h = scratch.chain.data();
+    size_t k = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        while (k >= 2 && AndrewAlgorithm::crossProduct(h[k - 2], h[k - 1], p[i]) <= 0) k--;
+        h[k++] = p[i];
+    }
+    const size_t base = k + 1;
+    for (size_t i = n - 1; i-- > 0;) {
+        while (k >= base && AndrewAlgorithm::crossProduct(h[k - 2], h[k - 1], p[i]) <= 0) k--;
+        h[k++] = p[i];
+    }
+
+    // The second chain ends on the first point again
+    std::copy(h, h + k - 1, out);
+    return k - 1;
+}
+
+bool BatchHull::compute(std::span<const Point> points, std::span<const size_t> offsets, Output& out) {
+    out.points.clear();
+    out.offsets.clear();
+    if (offsets.size() < 2) {
+        out.offsets.assign(1, 0);
+        return true;
+    }
+
+    for (size_t i = 0; i + 1 < offsets.size(); i++) {
+        if (offsets[i] > offsets[i + 1]) return false;
+    }
+    if (offsets.back() > points.size()) return false;
+
+    // Every hull is written at its set's position (a hull is never larger than its set)
+    // and its size is kept in offsets[i + 1]; the hulls are compacted afterwards
+    const size_t sets = offsets.size() - 1;
+    const size_t first = offsets.front();
+    out.points.resize(offsets.back() - first);
+    out.offsets.resize(sets + 1);
+
+    auto runRange = [&](size_t begin, size_t end) {
+        Scratch& scratch = threadScratch();
+        for (size_t i = begin; i < end; i++) {
+            const std::span<const Point> set = points.subspan(offsets[i], offsets[i + 1] - offsets[i]);
+            out.offsets[i + 1] = buildHull(set, scratch, out.points.data() + (offsets[i] - first));
+        }
+    };
+
+    if (m_pool) {
+        WorkStealingPool::TaskGroup tasks(*m_pool);
+        size_t begin = 0;
+        while (begin < sets) {
+            size_t end = begin + 1;
+            while (end < sets && offsets[end] - offsets[begin] < TASK_POINTS) end++;
+            tasks.run([&runRange, begin, end] { runRange(begin, end); });
+            begin = end;
+        }
+        tasks.wait();
+    } else {
+        runRange(0, sets);
+    }
+
+    size_t written = 0;
+    out.offsets[0] = 0;
+    for (size_t i = 0; i < sets; i++) {
+        const size_t source = offsets[i] - first;
+        const size_t count = out.offsets[i + 1];
+        if (source != written) {
+            std::copy(out.points.begin() + static_cast<std::ptrdiff_t>(source),
+                      out.points.begin() + static_cast<std::ptrdiff_t>(source + count),
+                      out.points.begin() + static_cast<std::ptrdiff_t>(written));
+        }
+        written += count;
+        out.offsets[i + 1] = written;
+    }
+    out.points.resize(written);
+    return true;
+}
+
+void BatchHull::setThreadCount(unsigned threadCount) {
+    if (threadCount <= 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != threadCount) {
+        m_pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+}
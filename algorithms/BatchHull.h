@@ -0,0 +1,41 @@
+#ifndef BATCHHULL_H
+#define BATCHHULL_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+#include "WorkStealingPool.h"
+#include "point_providers/Point.h"
+
+// Hulls of many small point sets in one call. The sets are given as one flat point
+// buffer plus offsets, and the hulls come back the same way, each in the layout of
+// AndrewAlgorithm's result. Every thread sorts and builds chains in its own scratch
+// arena that only grows, so a batch reusing its Output allocates nothing once warm.
+class BatchHull {
+public:
+    struct Output {
+        std::vector<Point> points;
+        std::vector<size_t> offsets; // hull i is points[offsets[i], offsets[i + 1])
+
+        size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+        std::span<const Point> hull(size_t i) const {
+            return {points.data() + offsets[i], offsets[i + 1] - offsets[i]};
+        }
+    };
+
+    BatchHull() = default;
+
+    // Set i is points[offsets[i], offsets[i + 1]), so k sets take k + 1 offsets.
+    // Returns false (and leaves out empty) if the offsets decrease or run past the points.
+    bool compute(std::span<const Point> points, std::span<const size_t> offsets, Output& out);
+
+    // Sets are distributed over the threads in runs of similar point counts
+    void setThreadCount(unsigned threadCount);
+    unsigned getThreadCount() const { return m_pool ? m_pool->getThreadCount() : 1; }
+
+private:
+    std::unique_ptr<WorkStealingPool> m_pool;
+};
+
+#endif //BATCHHULL_H
@@ -0,0 +1,227 @@
+#include "ChanAlgorithm.h"
+#include "AndrewAlgorithm.h"
+#include "Orientation.h"
+#include <algorithm>
+
+ChanAlgorithm::ChanAlgorithm(const std::vector<Point>& points) {
+    ChanAlgorithm::reset(points);
+}
+
+void ChanAlgorithm::reset(const std::vector<Point>& points) {
+    m_points = points;
+    m_miniHulls.clear();
+    m_hull.clear();
+    m_currentGroup = 0;
+    m_currentIndex = 0;
+    m_round = 1;
+    m_groupSize = std::min<size_t>(4, m_points.size());
+    m_finished = false;
+    m_phase = Phase::GROUPING;
+
+    if (m_points.size() < 3) {
+        m_hull = m_points;
+        m_finished = true;
+        m_phase = Phase::DONE;
+        return;
+    }
+
+    m_start = *std::min_element(m_points.begin(), m_points.end());
+}
+
+void ChanAlgorithm::setThreadCount(unsigned threadCount) {
+    if (threadCount <= 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != threadCount) {
+        m_pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+}
+
+static int orientation(const Point& o, const Point& a, const Point& b) {
+    return Orientation::sign(o, a, b);
+}
+
+static float squaredDistance(const Point& a, const Point& b) {
+    const float dx = b.x - a.x;
+    const float dy = b.y - a.y;
+    return dx * dx + dy * dy;
+}
+
+// Jarvis comparison seen from p: the candidate wins if it lies right of p->current,
+// or on the same ray but farther away (collinear hull points are skipped)
+bool ChanAlgorithm::isBetter(const Point& p, const Point& current, const Point& candidate) {
+    if (candidate == p) return false;
+    if (current == p) return true;
+
+    const int o = orientation(p, current, candidate);
+    if (o < 0) return true;
+    if (o > 0) return false;
+
+    const float dot = (current.x - p.x) * (candidate.x - p.x) + (current.y - p.y) * (candidate.y - p.y);
+    return dot > 0 && squaredDistance(p, candidate) > squaredDistance(p, current);
+}
+
+// True if vertex i of the polygon makes a better tangent from p than vertex j. Two vertices
+// on opposite rays from p are the ends of an edge p lies on; the end that follows the edge
+// counterclockwise is the better one, as nothing lies right of p -> that end
+bool ChanAlgorithm::isBetterVertex(const std::vector<Point>& hull, const Point& p, size_t i, size_t j) {
+    const Point& a = hull[i];
+    const Point& b = hull[j];
+    if (a != p && b != p && orientation(p, a, b) == 0 &&
+        (a.x - p.x) * (b.x - p.x) + (a.y - p.y) * (b.y - p.y) < 0) {
+        return i == (j + 1) % hull.size();
+    }
+    return isBetter(p, b, a);
+}
+
+size_t ChanAlgorithm::linearTangent(const std::vector<Point>& hull, const Point& p) {
+    size_t best = hull.size();
+    for (size_t i = 0; i < hull.size(); ++i) {
+        if (hull[i] == p) continue;
+        if (best == hull.size() || isBetterVertex(hull, p, i, best)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Rank the vertices by how good a tangent from p they make (isBetterVertex). Going around a convex polygon that p is
+// not strictly inside, this rank falls to the tangent and rises to the opposite extreme, so
+// the sequence is cyclically bitonic and its minimum is found by bisection on [0, k).
+// Taking vertex 0 as the reference, c lies before the tangent exactly when
+//  - the rank falls at 0, and it still falls at c without having risen above vertex 0, or
+//  - the rank rises at 0, and at c it falls or has not yet dropped below vertex 0.
+// If p is on the polygon, p itself ranks last.
+size_t ChanAlgorithm::tangent(const std::vector<Point>& hull, const Point& p) {
+    const size_t k = hull.size();
+    // A point or a segment has no polygon to search
+    if (k < 3) return linearTangent(hull, p);
+
+    auto better = [&](size_t i, size_t j) { return isBetterVertex(hull, p, i, j); };
+    auto falls = [&](size_t c) { return better((c + 1) % k, c); };
+
+    const bool fallsAtStart = falls(0);
+    if (!fallsAtStart && better(0, k - 1)) return 0;
+
+    auto beforeTangent = [&](size_t c) {
+        return fallsAtStart ? falls(c) && !better(0, c) : falls(c) || !better(c, 0);
+    };
+
+    size_t lo = 0;
+    size_t hi = k;
+    while (hi - lo > 1) {
+        const size_t c = lo + (hi - lo) / 2;
+        if (beforeTangent(c)) {
+            lo = c;
+        } else {
+            hi = c;
+        }
+    }
+    return hi;
+}
+
+// Splits the input into groups of m points and computes each group's hull with Andrew
+void ChanAlgorithm::buildMiniHulls() {
+    const size_t groups = (m_points.size() + m_groupSize - 1) / m_groupSize;
+    m_miniHulls.assign(groups, {});
+
+    auto buildGroup = [this](size_t g) {
+        const auto begin = m_points.begin() + static_cast<std::ptrdiff_t>(g * m_groupSize);
+        const auto end = m_points.begin() + static_cast<std::ptrdiff_t>(std::min(m_points.size(), (g + 1) * m_groupSize));
+        const std::vector<Point> group(begin, end);
+        AndrewAlgorithm andrew({});
+        m_miniHulls[g] = andrew.runCompleteAlgorithm(group);
+    };
+
+    if (m_pool) {
+        WorkStealingPool::TaskGroup tasks(*m_pool);
+        for (size_t g = 0; g < groups; ++g) {
+            tasks.run([&buildGroup, g] { buildGroup(g); });
+        }
+        tasks.wait();
+    } else {
+        for (size_t g = 0; g < groups; ++g) {
+            buildGroup(g);
+        }
+    }
+
+    // Andrew's hull starts at its lexicographically smallest point,
+    // so the global start is the first vertex of one of the mini hulls
+    for (size_t g = 0; g < groups; ++g) {
+        if (!m_miniHulls[g].empty() && m_miniHulls[g][0] == m_start) {
+            m_currentGroup = g;
+            m_currentIndex = 0;
+            break;
+        }
+    }
+
+    m_hull.clear();
+    m_hull.push_back(m_start);
+}
+
+// One Jarvis step: the next hull vertex is the best tangent over all mini hulls
+bool ChanAlgorithm::wrapStep() {
+    const Point p = m_hull.back();
+
+    // In its own group the next vertex is simply the successor on the mini hull
+    const std::vector<Point>& own = m_miniHulls[m_currentGroup];
+    size_t bestGroup = m_currentGroup;
+    size_t bestIndex = (m_currentIndex + 1) % own.size();
+    Point best = own[bestIndex];
+
+    for (size_t g = 0; g < m_miniHulls.size(); ++g) {
+        if (g == m_currentGroup) continue;
+        const size_t q = tangent(m_miniHulls[g], p);
+        if (q < m_miniHulls[g].size() && isBetter(p, best, m_miniHulls[g][q])) {
+            best = m_miniHulls[g][q];
+            bestGroup = g;
+            bestIndex = q;
+        }
+    }
+
+    if (best == m_start || best == p) {
+        m_phase = Phase::DONE;
+        m_finished = true;
+        return false;
+    }
+
+    if (m_hull.size() >= m_groupSize) {
+        // More than m hull vertices: this round's guess was too small
+        ++m_round;
+        const size_t exponent = size_t{1} << std::min(m_round, 6);
+        m_groupSize = exponent >= 63 ? m_points.size()
+                                     : std::min<size_t>(size_t{1} << exponent, m_points.size());
+        m_hull.clear();
+        m_phase = Phase::GROUPING;
+        return true;
+    }
+
+    m_hull.push_back(best);
+    m_currentGroup = bestGroup;
+    m_currentIndex = bestIndex;
+    return true;
+}
+
+bool ChanAlgorithm::step() {
+    if (m_finished) return false;
+
+    if (m_phase == Phase::GROUPING) {
+        buildMiniHulls();
+        m_phase = Phase::WRAPPING;
+        return true;
+    }
+    return wrapStep();
+}
+
+bool ChanAlgorithm::isFinished() const {
+    return m_finished;
+}
+
+std::vector<Point> ChanAlgorithm::getCurrentHull() {
+    return m_hull;
+}
+
+std::vector<Point> ChanAlgorithm::runCompleteAlgorithm(const std::vector<Point>& points) {
+    reset(points);
+    while (step()) {}
+    return m_hull;
+}
@@ -0,0 +1,64 @@
+#ifndef CHANALGORITHM_H
+#define CHANALGORITHM_H
+
+#include "IAlgorithm.h"
+#include "WorkStealingPool.h"
+#include <memory>
+#include <vector>
+
+// Chan's output-sensitive O(n log h) algorithm: the input is split into groups of
+// m points whose hulls are computed with Andrew's algorithm, then a Jarvis march
+// wraps the whole set using binary-search tangents into every mini hull. A round
+// gives up after m hull vertices and restarts with m = min(2^(2^t), n).
+class ChanAlgorithm : public IAlgorithm {
+public:
+    explicit ChanAlgorithm(const std::vector<Point>& points);
+
+    bool step() override;
+    std::vector<Point> getCurrentHull() override;
+    void reset(const std::vector<Point>& points) override;
+    bool isFinished() const override;
+    std::vector<Point> runCompleteAlgorithm(const std::vector<Point>& points) override;
+
+    // Mini hulls of different groups are computed in parallel for threadCount > 1
+    void setThreadCount(unsigned threadCount);
+    unsigned getThreadCount() const { return m_pool ? m_pool->getThreadCount() : 1; }
+
+    // Visualization methods
+    enum class Phase { GROUPING, WRAPPING, DONE };
+    Phase getPhase() const { return m_phase; }
+    size_t getGroupSize() const { return m_groupSize; }
+    const std::vector<std::vector<Point>>& getMiniHulls() const { return m_miniHulls; }
+    Point getCurrentPoint() const { return m_hull.empty() ? Point{} : m_hull.back(); }
+    bool hasCurrentPoint() const { return m_phase == Phase::WRAPPING && !m_hull.empty(); }
+
+    // Index of the vertex q of the counterclockwise polygon such that no vertex lies
+    // right of p->q (farthest one on ties), found by binary search; p must not be
+    // strictly inside the polygon
+    static size_t tangent(const std::vector<Point>& hull, const Point& p);
+    // The same by a linear scan, as the reference for tangent()
+    static size_t linearTangent(const std::vector<Point>& hull, const Point& p);
+
+private:
+    std::vector<Point> m_points;
+    std::vector<std::vector<Point>> m_miniHulls;
+    std::vector<Point> m_hull;
+
+    Point m_start;
+    size_t m_currentGroup;
+    size_t m_currentIndex;
+    size_t m_groupSize;
+    int m_round;
+    bool m_finished;
+    Phase m_phase;
+
+    std::unique_ptr<WorkStealingPool> m_pool;
+
+    void buildMiniHulls();
+    bool wrapStep();
+
+    static bool isBetter(const Point& p, const Point& current, const Point& candidate);
+    static bool isBetterVertex(const std::vector<Point>& hull, const Point& p, size_t i, size_t j);
+};
+
+#endif //CHANALGORITHM_H
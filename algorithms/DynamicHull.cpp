@@ -0,0 +1,285 @@
+#include "DynamicHull.h"
+#include "AndrewAlgorithm.h"
+#include <algorithm>
+
+// Scapegoat balance: a subtree is rebuilt once one child holds more than this share of its leaves
+constexpr double BALANCE = 0.7;
+
+static Point negate(const Point& p) {
+    return {-p.x, -p.y};
+}
+
+// Leaves for p and q are ordered by the same (x, y) order AndrewAlgorithm sorts by
+static bool lessXY(const Point& a, const Point& b) {
+    return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+}
+
+void DynamicHull::assign(const std::vector<Point>& points) {
+    std::vector<Point> negated;
+    negated.reserve(points.size());
+    for (const auto& p : points) {
+        negated.push_back(negate(p));
+    }
+
+    m_lower.assign(points);
+    m_upper.assign(std::move(negated));
+    m_size = points.size();
+}
+
+void DynamicHull::insert(const Point& p) {
+    m_lower.insert(p);
+    m_upper.insert(negate(p));
+    m_size++;
+}
+
+bool DynamicHull::erase(const Point& p) {
+    if (!m_lower.erase(p)) {
+        return false;
+    }
+    m_upper.erase(negate(p));
+    m_size--;
+    return true;
+}
+
+bool DynamicHull::contains(const Point& p) const {
+    return m_lower.contains(p);
+}
+
+void DynamicHull::clear() {
+    m_lower.clear();
+    m_upper.clear();
+    m_size = 0;
+}
+
+std::vector<Point> DynamicHull::hull() const {
+    std::vector<Point> lower;
+    std::vector<Point> upper;
+    m_lower.collect(lower);
+    m_upper.collect(upper);
+
+    if (lower.size() < 2) {
+        return lower;
+    }
+
+    // Lower chain left to right, then the upper chain right to left without its endpoints.
+    // The negated tree lists the upper chain from the rightmost point already.
+    std::vector<Point> hull = lower;
+    for (size_t i = 1; i + 1 < upper.size(); i++) {
+        hull.push_back(negate(upper[i]));
+    }
+    return hull;
+}
+
+// --- ChainTree ---
+
+void DynamicHull::ChainTree::assign(std::vector<Point> points) {
+    m_root.reset();
+    if (points.empty()) return;
+
+    std::sort(points.begin(), points.end(), lessXY);
+
+    // One leaf per distinct point, duplicates become its count
+    std::vector<std::unique_ptr<Node>> leaves;
+    for (const auto& p : points) {
+        if (!leaves.empty() && leaves.back()->point == p) {
+            leaves.back()->count++;
+        } else {
+            leaves.push_back(makeLeaf(p));
+        }
+    }
+    m_root = build(leaves, 0, leaves.size());
+}
+
+void DynamicHull::ChainTree::insert(const Point& p) {
+    if (!m_root) {
+        m_root = makeLeaf(p);
+        return;
+    }
+    insert(m_root, p);
+}
+
+bool DynamicHull::ChainTree::erase(const Point& p) {
+    if (!m_root) return false;
+
+    if (m_root->isLeaf()) {
+        if (!(m_root->point == p)) return false;
+        if (--m_root->count == 0) m_root.reset();
+        return true;
+    }
+
+    bool found = false;
+    erase(m_root, p, found);
+    return found;
+}
+
+bool DynamicHull::ChainTree::contains(const Point& p) const {
+    const Node* node = m_root.get();
+    while (node && !node->isLeaf()) {
+        node = lessXY(node->left->maxPoint, p) ? node->right.get() : node->left.get();
+    }
+    return node && node->point == p;
+}
+
+std::unique_ptr<DynamicHull::ChainTree::Node> DynamicHull::ChainTree::makeLeaf(const Point& p) {
+    auto leaf = std::make_unique<Node>();
+    leaf->point = p;
+    leaf->maxPoint = p;
+    return leaf;
+}
+
+// Returns true if the set of distinct points below node changed
+bool DynamicHull::ChainTree::insert(std::unique_ptr<Node>& node, const Point& p) {
+    if (node->isLeaf()) {
+        if (node->point == p) {
+            node->count++;
+            return false;
+        }
+
+        // Split the leaf into an internal node with both points as children
+        auto leaf = makeLeaf(p);
+        auto parent = std::make_unique<Node>();
+        if (lessXY(p, node->point)) {
+            parent->left = std::move(leaf);
+            parent->right = std::move(node);
+        } else {
+            parent->left = std::move(node);
+            parent->right = std::move(leaf);
+        }
+        node = std::move(parent);
+        update(*node);
+        return true;
+    }
+
+    auto& child = lessXY(node->left->maxPoint, p) ? node->right : node->left;
+    if (!insert(child, p)) {
+        return false;
+    }
+    update(*node);
+    rebalance(node);
+    return true;
+}
+
+bool DynamicHull::ChainTree::erase(std::unique_ptr<Node>& node, const Point& p, bool& found) {
+    const bool goRight = lessXY(node->left->maxPoint, p);
+    auto& child = goRight ? node->right : node->left;
+
+    if (child->isLeaf()) {
+        if (!(child->point == p)) return false;
+        found = true;
+        if (--child->count > 0) return false;
+
+        // The sibling takes the place of the parent
+        node = std::move(goRight ? node->left : node->right);
+        return true;
+    }
+
+    if (!erase(child, p, found)) {
+        return false;
+    }
+    update(*node);
+    rebalance(node);
+    return true;
+}
+
+// Recomputes the subtree summary and the bridge from the two children
+void DynamicHull::ChainTree::update(Node& node) {
+    node.leaves = node.left->leaves + node.right->leaves;
+    node.maxPoint = node.right->maxPoint;
+    bridge(node.left.get(), node.right.get(), node.bridgeLeft, node.bridgeRight);
+}
+
+void DynamicHull::ChainTree::rebalance(std::unique_ptr<Node>& node) {
+    const size_t heavy = std::max(node->left->leaves, node->right->leaves);
+    if (static_cast<double>(heavy) <= BALANCE * static_cast<double>(node->leaves)) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<Node>> leaves;
+    leaves.reserve(node->leaves);
+    flatten(std::move(node), leaves);
+    node = build(leaves, 0, leaves.size());
+}
+
+void DynamicHull::ChainTree::flatten(std::unique_ptr<Node> node, std::vector<std::unique_ptr<Node>>& leaves) {
+    if (node->isLeaf()) {
+        leaves.push_back(std::move(node));
+        return;
+    }
+    flatten(std::move(node->left), leaves);
+    flatten(std::move(node->right), leaves);
+}
+
+// Perfectly balanced subtree over leaves[begin, end), bridges computed bottom-up
+std::unique_ptr<DynamicHull::ChainTree::Node> DynamicHull::ChainTree::build(
+        std::vector<std::unique_ptr<Node>>& leaves, size_t begin, size_t end) {
+    if (end - begin == 1) {
+        return std::move(leaves[begin]);
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    auto node = std::make_unique<Node>();
+    node->left = build(leaves, begin, mid);
+    node->right = build(leaves, mid, end);
+    update(*node);
+    return node;
+}
+
+// Vertex t of the subtree's chain such that no point of the subtree is right of q -> t
+// (the farthest one if several are collinear); q must precede every point of the subtree.
+// The bridge of a node splits its chain, so the unimodal search only needs one side.
+Point DynamicHull::ChainTree::tangent(const Node* node, const Point& q) {
+    while (!node->isLeaf()) {
+        if (AndrewAlgorithm::crossProduct(q, node->bridgeLeft, node->bridgeRight) <= 0) {
+            node = node->right.get();
+        } else {
+            node = node->left.get();
+        }
+    }
+    return node->point;
+}
+
+// Common tangent of the chains of two subtrees, every point of left preceding every point of right.
+// Descends the left subtree: if the chain turns left at the first vertex after the node's bridge
+// towards its tangent into right, the bridge starts in the right part, otherwise in the left part.
+void DynamicHull::ChainTree::bridge(const Node* left, const Node* right, Point& from, Point& to) {
+    while (!left->isLeaf()) {
+        const Point t = tangent(right, left->bridgeRight);
+        if (AndrewAlgorithm::crossProduct(left->bridgeLeft, left->bridgeRight, t) > 0) {
+            left = left->right.get();
+        } else {
+            left = left->left.get();
+        }
+    }
+    from = left->point;
+    to = tangent(right, from);
+}
+
+void DynamicHull::ChainTree::collect(std::vector<Point>& out) const {
+    if (!m_root) return;
+    if (m_root->isLeaf()) {
+        out.push_back(m_root->point);
+        return;
+    }
+
+    // The chain of a subtree is its left chain up to the bridge followed by its right chain
+    const Node* first = m_root.get();
+    while (!first->isLeaf()) first = first->left.get();
+    collect(m_root.get(), first->point, m_root->maxPoint, out);
+}
+
+// Appends the chain vertices of node that lie within [lo, hi]
+void DynamicHull::ChainTree::collect(const Node* node, const Point& lo, const Point& hi, std::vector<Point>& out) {
+    if (node->isLeaf()) {
+        if (!lessXY(node->point, lo) && !lessXY(hi, node->point)) {
+            out.push_back(node->point);
+        }
+        return;
+    }
+
+    if (!lessXY(node->bridgeLeft, lo)) {
+        collect(node->left.get(), lo, lessXY(hi, node->bridgeLeft) ? hi : node->bridgeLeft, out);
+    }
+    if (!lessXY(hi, node->bridgeRight)) {
+        collect(node->right.get(), lessXY(node->bridgeRight, lo) ? lo : node->bridgeRight, hi, out);
+    }
+}
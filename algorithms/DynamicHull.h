@@ -0,0 +1,79 @@
+#ifndef DYNAMICHULL_H
+#define DYNAMICHULL_H
+
+#include <memory>
+#include <vector>
+#include "point_providers/Point.h"
+
+// Fully dynamic convex hull with insert and erase in polylogarithmic time.
+// Each of the two chains is a leaf-oriented scapegoat tree over the points in
+// (x, y) order; every internal node stores the bridge between the chains of its
+// two subtrees (Overmars and van Leeuwen), found by descending both subtrees.
+// The hull is reported in O(h log n) and matches AndrewAlgorithm's output:
+// counterclockwise, starting at the smallest point, collinear points removed.
+class DynamicHull {
+public:
+    DynamicHull() = default;
+    explicit DynamicHull(const std::vector<Point>& points) { assign(points); }
+
+    // Replaces the set; builds balanced trees in O(n log^2 n) instead of n single insertions
+    void assign(const std::vector<Point>& points);
+    void insert(const Point& p);
+    // Removes one copy of p; false if p is not in the set
+    bool erase(const Point& p);
+    bool contains(const Point& p) const;
+    void clear();
+
+    // Number of points including duplicates
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    std::vector<Point> hull() const;
+
+private:
+    // Lower chain (left turns in ascending order) of a dynamic point set
+    class ChainTree {
+    public:
+        void insert(const Point& p);
+        bool erase(const Point& p);
+        bool contains(const Point& p) const;
+        void clear() { m_root.reset(); }
+        void assign(std::vector<Point> points);
+
+        // Chain vertices from the smallest to the largest point
+        void collect(std::vector<Point>& out) const;
+
+    private:
+        struct Node {
+            Point point;        // leaf: the stored point
+            size_t count = 1;   // leaf: multiplicity
+            size_t leaves = 1;  // leaves in this subtree
+            Point maxPoint;     // largest point in this subtree
+            Point bridgeLeft;   // internal: bridge from the left to the right subtree chain
+            Point bridgeRight;
+            std::unique_ptr<Node> left;
+            std::unique_ptr<Node> right;
+
+            bool isLeaf() const { return !left; }
+        };
+
+        std::unique_ptr<Node> m_root;
+
+        static std::unique_ptr<Node> makeLeaf(const Point& p);
+        static bool insert(std::unique_ptr<Node>& node, const Point& p);
+        static bool erase(std::unique_ptr<Node>& node, const Point& p, bool& found);
+        static void update(Node& node);
+        static void rebalance(std::unique_ptr<Node>& node);
+        static void flatten(std::unique_ptr<Node> node, std::vector<std::unique_ptr<Node>>& leaves);
+        static std::unique_ptr<Node> build(std::vector<std::unique_ptr<Node>>& leaves, size_t begin, size_t end);
+        static Point tangent(const Node* node, const Point& q);
+        static void bridge(const Node* left, const Node* right, Point& from, Point& to);
+        static void collect(const Node* node, const Point& lo, const Point& hi, std::vector<Point>& out);
+    };
+
+    ChainTree m_lower;  // points as given
+    ChainTree m_upper;  // negated points: its lower chain is the upper chain rotated by 180 degrees
+    size_t m_size = 0;
+};
+
+#endif //DYNAMICHULL_H
@@ -0,0 +1,24 @@
+#include "FilteredAlgorithm.h"
+
+FilteredAlgorithm::FilteredAlgorithm(std::unique_ptr<IAlgorithm> inner, int directions)
+    : m_inner(std::move(inner)), m_filter(directions) {}
+
+bool FilteredAlgorithm::step() {
+    return m_inner->step();
+}
+
+std::vector<Point> FilteredAlgorithm::getCurrentHull() {
+    return m_inner->getCurrentHull();
+}
+
+void FilteredAlgorithm::reset(const std::vector<Point>& points) {
+    m_inner->reset(m_filter.apply(points));
+}
+
+bool FilteredAlgorithm::isFinished() const {
+    return m_inner->isFinished();
+}
+
+std::vector<Point> FilteredAlgorithm::runCompleteAlgorithm(const std::vector<Point>& points) {
+    return m_inner->runCompleteAlgorithm(m_filter.apply(points));
+}
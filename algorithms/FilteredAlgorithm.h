@@ -0,0 +1,28 @@
+#ifndef FILTEREDALGORITHM_H
+#define FILTEREDALGORITHM_H
+
+#include <memory>
+#include "IAlgorithm.h"
+#include "AklToussaintFilter.h"
+
+// Pipeline stage: runs the Akl–Toussaint prefilter in front of any IAlgorithm
+class FilteredAlgorithm : public IAlgorithm {
+public:
+    FilteredAlgorithm(std::unique_ptr<IAlgorithm> inner, int directions = 8);
+
+    bool step() override;
+    std::vector<Point> getCurrentHull() override;
+    void reset(const std::vector<Point>& points) override;
+    bool isFinished() const override;
+    std::vector<Point> runCompleteAlgorithm(const std::vector<Point>& points) override;
+
+    IAlgorithm& getInner() { return *m_inner; }
+    const AklToussaintFilter& getFilter() const { return m_filter; }
+    size_t getCulledCount() const { return m_filter.getCulledCount(); }
+
+private:
+    std::unique_ptr<IAlgorithm> m_inner;
+    AklToussaintFilter m_filter;
+};
+
+#endif //FILTEREDALGORITHM_H
@@ -3,15 +3,21 @@
 
 #include <vector>
 #include "point_providers/Point.h"
-class IAlgorithm {
+
+template <class T>
+class BasicIAlgorithm {
 public:
-    virtual ~IAlgorithm() = default;
+    using PointType = BasicPoint<T>;
+
+    virtual ~BasicIAlgorithm() = default;
 
     virtual bool step() = 0;
-    virtual std::vector<Point> runCompleteAlgorithm(const std::vector<Point>& points) = 0;
-    virtual std::vector<Point> getCurrentHull() = 0;
+    virtual std::vector<PointType> runCompleteAlgorithm(const std::vector<PointType>& points) = 0;
+    virtual std::vector<PointType> getCurrentHull() = 0;
     virtual bool isFinished() const = 0;
-    virtual void reset(const std::vector<Point>& points) = 0;
+    virtual void reset(const std::vector<PointType>& points) = 0;
 };
 
+using IAlgorithm = BasicIAlgorithm<float>;
+
 #endif //IALGORITHM_H
@@ -0,0 +1,95 @@
+#include "IncrementalHull.h"
+#include "AndrewAlgorithm.h"
+#include <iterator>
+
+static Point negate(const Point& p) {
+    return {-p.x, -p.y};
+}
+
+bool IncrementalHull::addPoint(const Point& p) {
+    if (contains(p)) {
+        m_rejected++;
+        return false;
+    }
+    m_lower.insert(p);
+    m_upper.insert(negate(p));
+    return true;
+}
+
+size_t IncrementalHull::addPoints(const std::vector<Point>& points) {
+    size_t added = 0;
+    for (const auto& p : points) {
+        if (addPoint(p)) added++;
+    }
+    return added;
+}
+
+bool IncrementalHull::contains(const Point& p) const {
+    return m_lower.covers(p) && m_upper.covers(negate(p));
+}
+
+std::vector<Point> IncrementalHull::hull() const {
+    const auto& lower = m_lower.points();
+    const auto& upper = m_upper.points();
+
+    // Lower chain left to right, then the upper chain right to left without its endpoints
+    std::vector<Point> hull(lower.begin(), lower.end());
+    if (upper.size() > 2) {
+        for (auto it = std::next(upper.begin()); it != std::prev(upper.end()); ++it) {
+            hull.push_back(negate(*it));
+        }
+    }
+    return hull;
+}
+
+size_t IncrementalHull::getHullSize() const {
+    const size_t upper = m_upper.points().size();
+    return m_lower.points().size() + (upper > 2 ? upper - 2 : 0);
+}
+
+void IncrementalHull::clear() {
+    m_lower.clear();
+    m_upper.clear();
+    m_rejected = 0;
+}
+
+// True if p lies within the x-range of the chain and on or above it
+bool IncrementalHull::Chain::covers(const Point& p) const {
+    if (m_points.empty()) return false;
+
+    const auto it = m_points.lower_bound(p);
+    if (it == m_points.end()) return false;
+    if (*it == p) return true;
+    if (it == m_points.begin()) return false;
+
+    const auto prev = std::prev(it);
+    return AndrewAlgorithm::crossProduct(*prev, *it, p) >= 0;
+}
+
+// Splices p into the chain and removes the neighbours that are no longer strict left turns
+void IncrementalHull::Chain::insert(const Point& p) {
+    const auto [pos, inserted] = m_points.insert(p);
+    if (!inserted) return;
+
+    // A point strictly between two vertices must lie below their edge to be a vertex itself
+    if (pos != m_points.begin() && std::next(pos) != m_points.end()) {
+        if (AndrewAlgorithm::crossProduct(*std::prev(pos), *std::next(pos), p) >= 0) {
+            m_points.erase(pos);
+            return;
+        }
+    }
+
+    // Right side: drop next while p -> next -> after is not a left turn
+    while (std::next(pos) != m_points.end() && std::next(pos, 2) != m_points.end()) {
+        const auto next = std::next(pos);
+        if (AndrewAlgorithm::crossProduct(p, *next, *std::next(next)) > 0) break;
+        m_points.erase(next);
+    }
+
+    // Left side: drop prev while before -> prev -> p is not a left turn
+    while (pos != m_points.begin() && std::prev(pos) != m_points.begin()) {
+        const auto prev = std::prev(pos);
+        if (AndrewAlgorithm::crossProduct(*std::prev(prev), *prev, p) > 0) break;
+        m_points.erase(prev);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef INCREMENTALHULL_H
+#define INCREMENTALHULL_H
+
+#include <cstddef>
+#include <set>
+#include <vector>
+#include "point_providers/Point.h"
+
+// Insert-only convex hull. The lower and upper chains are kept in ordered sets, so a
+// point inside the hull is rejected with two O(log h) lookups and an extreme point is
+// spliced in after a search for its position, removing the vertices it hides.
+// A batch of k points costs O(k log h) amortized, independent of the points seen before.
+// The hull has the same form as IAlgorithm::getCurrentHull / AndrewAlgorithm's result.
+class IncrementalHull {
+public:
+    IncrementalHull() = default;
+    // Start from any point set, e.g. the hull an IAlgorithm has already computed
+    explicit IncrementalHull(const std::vector<Point>& points) { addPoints(points); }
+
+    // Returns false if p lies inside or on the current hull and was rejected
+    bool addPoint(const Point& p);
+    // Returns the number of points that changed the hull
+    size_t addPoints(const std::vector<Point>& points);
+
+    // Point-in-polygon test in O(log h); boundary points count as inside
+    bool contains(const Point& p) const;
+
+    std::vector<Point> hull() const;
+    size_t getHullSize() const;
+    size_t getRejectedCount() const { return m_rejected; }
+    void clear();
+
+private:
+    // Lower chain of the inserted points: left turns in (x, y) order, collinear points removed
+    class Chain {
+    public:
+        bool covers(const Point& p) const;
+        void insert(const Point& p);
+        const std::set<Point>& points() const { return m_points; }
+        void clear() { m_points.clear(); }
+
+    private:
+        std::set<Point> m_points;
+    };
+
+    Chain m_lower;
+    Chain m_upper;  // lower chain of the negated points
+    size_t m_rejected = 0;
+};
+
+#endif //INCREMENTALHULL_H
@@ -0,0 +1,226 @@
+#include "Orientation.h"
+
+// Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+// Predicates" (1997). Expansions are sums of non-overlapping doubles, least significant
+// component first. Everything relies on strict IEEE double rounding, so this file must
+// not be compiled with -ffast-math or similar flags.
+
+constexpr double EPSILON = 0x1p-53;
+constexpr double SPLITTER = 0x1p27 + 1.0;
+constexpr double RESULT_ERRBOUND = (3.0 + 8.0 * EPSILON) * EPSILON;
+constexpr double CCW_ERRBOUND_A = (3.0 + 16.0 * EPSILON) * EPSILON;
+constexpr double CCW_ERRBOUND_B = (2.0 + 12.0 * EPSILON) * EPSILON;
+constexpr double CCW_ERRBOUND_C = (9.0 + 64.0 * EPSILON) * EPSILON * EPSILON;
+
+// x + y == a + b exactly, x = fl(a + b)
+static void twoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    const double bVirtual = x - a;
+    const double aVirtual = x - bVirtual;
+    y = (a - aVirtual) + (b - bVirtual);
+}
+
+// Same as twoSum, but requires |a| >= |b|
+static void fastTwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    y = b - (x - a);
+}
+
+// Rounding error of x = fl(a - b)
+static double twoDiffTail(double a, double b, double x) {
+    const double bVirtual = a - x;
+    const double aVirtual = x + bVirtual;
+    return (a - aVirtual) + (bVirtual - b);
+}
+
+static void twoDiff(double a, double b, double& x, double& y) {
+    x = a - b;
+    y = twoDiffTail(a, b, x);
+}
+
+// Splits a into two halves of at most 26 significant bits each
+static void split(double a, double& hi, double& lo) {
+    const double c = SPLITTER * a;
+    const double big = c - a;
+    hi = c - big;
+    lo = a - hi;
+}
+
+// x + y == a * b exactly, x = fl(a * b)
+static void twoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+    double aHi, aLo, bHi, bLo;
+    split(a, aHi, aLo);
+    split(b, bHi, bLo);
+    const double err1 = x - aHi * bHi;
+    const double err2 = err1 - aLo * bHi;
+    const double err3 = err2 - aHi * bLo;
+    y = aLo * bLo - err3;
+}
+
+// (a1 + a0) - (b1 + b0) as a four component expansion
+static void twoTwoDiff(double a1, double a0, double b1, double b0, double x[4]) {
+    double i, j, k;
+    twoDiff(a0, b0, i, x[0]);
+    twoSum(a1, i, j, k);
+    twoDiff(k, b1, i, x[1]);
+    twoSum(j, i, x[3], x[2]);
+}
+
+// h = e + f with zero components removed; returns the length of h
+static int fastExpansionSumZeroElim(int eLength, const double* e, int fLength, const double* f, double* h) {
+    int ei = 0;
+    int fi = 0;
+    int hi = 0;
+    double eNow = e[0];
+    double fNow = f[0];
+    double q, qNew, hh;
+
+    auto nextE = [&] { if (++ei < eLength) eNow = e[ei]; };
+    auto nextF = [&] { if (++fi < fLength) fNow = f[fi]; };
+
+    if ((fNow > eNow) == (fNow > -eNow)) {
+        q = eNow;
+        nextE();
+    } else {
+        q = fNow;
+        nextF();
+    }
+
+    if (ei < eLength && fi < fLength) {
+        if ((fNow > eNow) == (fNow > -eNow)) {
+            fastTwoSum(eNow, q, qNew, hh);
+            nextE();
+        } else {
+            fastTwoSum(fNow, q, qNew, hh);
+            nextF();
+        }
+        q = qNew;
+        if (hh != 0.0) h[hi++] = hh;
+
+        while (ei < eLength && fi < fLength) {
+            if ((fNow > eNow) == (fNow > -eNow)) {
+                twoSum(q, eNow, qNew, hh);
+                nextE();
+            } else {
+                twoSum(q, fNow, qNew, hh);
+                nextF();
+            }
+            q = qNew;
+            if (hh != 0.0) h[hi++] = hh;
+        }
+    }
+    while (ei < eLength) {
+        twoSum(q, eNow, qNew, hh);
+        nextE();
+        q = qNew;
+        if (hh != 0.0) h[hi++] = hh;
+    }
+    while (fi < fLength) {
+        twoSum(q, fNow, qNew, hh);
+        nextF();
+        q = qNew;
+        if (hh != 0.0) h[hi++] = hh;
+    }
+    if (q != 0.0 || hi == 0) h[hi++] = q;
+    return hi;
+}
+
+static double estimate(int length, const double* e) {
+    double sum = e[0];
+    for (int i = 1; i < length; i++) sum += e[i];
+    return sum;
+}
+
+// Stages B to D: the determinant is refined until its sign is certain
+static double orient2dAdapt(const DoublePoint& o, const DoublePoint& a, const DoublePoint& b, double detSum) {
+    const double ax = a.x, ay = a.y, bx = b.x, by = b.y, ox = o.x, oy = o.y;
+    const double acx = ax - ox;
+    const double bcx = bx - ox;
+    const double acy = ay - oy;
+    const double bcy = by - oy;
+
+    double detLeft, detLeftTail, detRight, detRightTail;
+    twoProduct(acx, bcy, detLeft, detLeftTail);
+    twoProduct(acy, bcx, detRight, detRightTail);
+
+    double B[4];
+    twoTwoDiff(detLeft, detLeftTail, detRight, detRightTail, B);
+    double det = estimate(4, B);
+    double errBound = CCW_ERRBOUND_B * detSum;
+    if (det >= errBound || -det >= errBound) {
+        return det;
+    }
+
+    const double acxTail = twoDiffTail(ax, ox, acx);
+    const double bcxTail = twoDiffTail(bx, ox, bcx);
+    const double acyTail = twoDiffTail(ay, oy, acy);
+    const double bcyTail = twoDiffTail(by, oy, bcy);
+    if (acxTail == 0.0 && acyTail == 0.0 && bcxTail == 0.0 && bcyTail == 0.0) {
+        return det;
+    }
+
+    errBound = CCW_ERRBOUND_C * detSum + RESULT_ERRBOUND * std::fabs(det);
+    det += (acx * bcyTail + bcy * acxTail) - (acy * bcxTail + bcx * acyTail);
+    if (det >= errBound || -det >= errBound) {
+        return det;
+    }
+
+    double s1, s0, t1, t0;
+    double u[4];
+    double C1[8], C2[12], D[16];
+
+    twoProduct(acxTail, bcy, s1, s0);
+    twoProduct(acyTail, bcx, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    const int c1Length = fastExpansionSumZeroElim(4, B, 4, u, C1);
+
+    twoProduct(acx, bcyTail, s1, s0);
+    twoProduct(acy, bcxTail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    const int c2Length = fastExpansionSumZeroElim(c1Length, C1, 4, u, C2);
+
+    twoProduct(acxTail, bcyTail, s1, s0);
+    twoProduct(acyTail, bcxTail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    const int dLength = fastExpansionSumZeroElim(c2Length, C2, 4, u, D);
+
+    return D[dLength - 1];
+}
+
+double Orientation::orient2d(const Point& o, const Point& a, const Point& b) {
+    return orient2d(DoublePoint{o.x, o.y}, DoublePoint{a.x, a.y}, DoublePoint{b.x, b.y});
+}
+
+double Orientation::orient2d(const DoublePoint& o, const DoublePoint& a, const DoublePoint& b) {
+    const double detLeft = (a.x - o.x) * (b.y - o.y);
+    const double detRight = (a.y - o.y) * (b.x - o.x);
+    const double det = detLeft - detRight;
+
+    double detSum;
+    if (detLeft > 0.0) {
+        if (detRight <= 0.0) return det;
+        detSum = detLeft + detRight;
+    } else if (detLeft < 0.0) {
+        if (detRight >= 0.0) return det;
+        detSum = -detLeft - detRight;
+    } else {
+        return det;
+    }
+
+    const double errBound = CCW_ERRBOUND_A * detSum;
+    if (det >= errBound || -det >= errBound) {
+        return det;
+    }
+    return orient2dAdapt(o, a, b, detSum);
+}
+
+float Orientation::exactCross(const Point& o, const Point& a, const Point& b) {
+    const double det = orient2d(o, a, b);
+    const auto c = static_cast<float>(det);
+    if (c == 0.0f && det != 0.0) {
+        const float tiny = std::numeric_limits<float>::denorm_min();
+        return det > 0.0 ? tiny : -tiny;
+    }
+    return c;
+}
@@ -0,0 +1,131 @@
+#ifndef ORIENTATION_H
+#define ORIENTATION_H
+
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "point_providers/Point.h"
+
+// Orientation predicate shared by the hull algorithms. cross(o, a, b) is evaluated in
+// float with the same operations as before, then checked against a forward error bound;
+// results the bound cannot certify (near-collinear or overflowed ones) are recomputed with
+// Shewchuk's adaptive precision orient2d. The sign of the result is therefore exact,
+// while certified results are returned unchanged.
+// Double points go through orient2d directly. Integer points are evaluated exactly in
+// 128-bit arithmetic, so they need no filter at all; those overloads exist only where the
+// compiler provides __int128 (GCC and Clang on 64-bit targets).
+
+#ifdef __SIZEOF_INT128__
+// The int64 cross product, which needs up to 131 bits, as high * 2^64 + low. It compares
+// and negates like the number it stands for, which is all the algorithms do with it.
+struct WideCross {
+    __int128 high = 0;
+    std::uint64_t low = 0;
+
+    constexpr WideCross() = default;
+    constexpr WideCross(__int128 value) : high(value >> 64), low(static_cast<std::uint64_t>(value)) {}
+    constexpr WideCross(__int128 high, std::uint64_t low) : high(high), low(low) {}
+
+    constexpr WideCross operator-() const {
+        return low == 0 ? WideCross(-high, 0) : WideCross(-high - 1, ~low + 1);
+    }
+
+    friend constexpr std::strong_ordering operator<=>(const WideCross&, const WideCross&) = default;
+    friend constexpr bool operator==(const WideCross&, const WideCross&) = default;
+};
+#endif
+
+class Orientation {
+public:
+    // (a - o) x (b - o): positive if o -> a -> b turns left, zero only if collinear
+    static float cross(const Point& o, const Point& a, const Point& b) {
+        const float left = (a.x - o.x) * (b.y - o.y);
+        const float right = (a.y - o.y) * (b.x - o.x);
+        const float c = left - right;
+        if (std::fabs(c) > errorBound(left, right)) {
+            return c;
+        }
+        return exactCross(o, a, b);
+    }
+
+    static double cross(const DoublePoint& o, const DoublePoint& a, const DoublePoint& b) {
+        return orient2d(o, a, b);
+    }
+
+#ifdef __SIZEOF_INT128__
+    // Exact for any int32 input: the differences need 33 bits and their products 66
+    template <class T> requires std::is_integral_v<T> && (sizeof(T) <= 4)
+    static __int128 cross(const BasicPoint<T>& o, const BasicPoint<T>& a, const BasicPoint<T>& b) {
+        const __int128 ax = static_cast<__int128>(a.x) - o.x;
+        const __int128 ay = static_cast<__int128>(a.y) - o.y;
+        const __int128 bx = static_cast<__int128>(b.x) - o.x;
+        const __int128 by = static_cast<__int128>(b.y) - o.y;
+        return ax * by - ay * bx;
+    }
+
+    // Exact for any int64 input. Differences below 2^62, the usual case, are multiplied in
+    // 128 bits directly; larger ones would overflow there and go through wideCross
+    template <class T> requires std::is_integral_v<T> && (sizeof(T) == 8)
+    static WideCross cross(const BasicPoint<T>& o, const BasicPoint<T>& a, const BasicPoint<T>& b) {
+        const __int128 ax = static_cast<__int128>(a.x) - o.x;
+        const __int128 ay = static_cast<__int128>(a.y) - o.y;
+        const __int128 bx = static_cast<__int128>(b.x) - o.x;
+        const __int128 by = static_cast<__int128>(b.y) - o.y;
+        constexpr __int128 LIMIT = __int128{1} << 62;
+        auto small = [](__int128 v) { return v > -LIMIT && v < LIMIT; };
+        if (small(ax) && small(ay) && small(bx) && small(by)) {
+            return ax * by - ay * bx;
+        }
+        return wideCross(ax, ay, bx, by);
+    }
+
+    // ax * by - ay * bx for differences below 2^64 in magnitude. Each is split as
+    // hi * 2^32 + lo with 0 <= lo < 2^32, so every partial product fits in 128 bits.
+    static constexpr WideCross wideCross(__int128 ax, __int128 ay, __int128 bx, __int128 by) {
+        auto hi = [](__int128 v) { return v >> 32; };
+        auto lo = [](__int128 v) { return v & 0xffffffff; };
+        const __int128 top = hi(ax) * hi(by) - hi(ay) * hi(bx);
+        const __int128 mid = hi(ax) * lo(by) + lo(ax) * hi(by) - hi(ay) * lo(bx) - lo(ay) * hi(bx);
+        const __int128 bottom = lo(ax) * lo(by) - lo(ay) * lo(bx);
+        const __int128 rest = mid * (__int128{1} << 32) + bottom;
+        return WideCross(top + (rest >> 64), static_cast<std::uint64_t>(rest));
+    }
+#endif
+
+    // -1, 0 or 1
+    template <class T>
+    static int sign(const BasicPoint<T>& o, const BasicPoint<T>& a, const BasicPoint<T>& b) {
+        const auto c = cross(o, a, b);
+        return (c > 0) - (c < 0);
+    }
+
+    // Bound on the error of left - right computed in float, as in Shewchuk's first stage:
+    // if the products differ in sign nothing cancels and |left + right| <= |c| lets any
+    // nonzero result pass. NaN and infinity never pass the test |c| > bound, and the
+    // smallest subnormal covers underflowing products.
+    static float errorBound(float left, float right) {
+        return ERRBOUND * std::fabs(left + right) + std::numeric_limits<float>::denorm_min();
+    }
+
+    // orient2d rounded to float; results below the float range keep their sign
+    static float exactCross(const Point& o, const Point& a, const Point& b);
+
+    // Shewchuk's orient2d on the coordinates as doubles: exact sign, and the magnitude
+    // is exact up to a relative error of a few ulps
+    static double orient2d(const Point& o, const Point& a, const Point& b);
+    static double orient2d(const DoublePoint& o, const DoublePoint& a, const DoublePoint& b);
+
+    // (3 + 16e) e with e = 2^-24, Shewchuk's first stage bound for float arithmetic
+    static constexpr float ERRBOUND = (3.0f + 16.0f * 0x1p-24f) * 0x1p-24f;
+};
+
+// Result type of Orientation::cross for points with coordinates of type T
+template <class T>
+using CrossType = decltype(Orientation::cross(std::declval<BasicPoint<T>>(),
+                                              std::declval<BasicPoint<T>>(),
+                                              std::declval<BasicPoint<T>>()));
+
+#endif //ORIENTATION_H
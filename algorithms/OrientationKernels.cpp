@@ -0,0 +1,476 @@
+#include "OrientationKernels.h"
+#include "Orientation.h"
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CONVEX_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang compile each variant for its own instruction set; MSVC accepts the intrinsics as is
+#if defined(__GNUC__) || defined(__clang__)
+#define CONVEX_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CONVEX_TARGET(isa)
+#endif
+
+// Every kernel evaluates Orientation::cross: the float cross product, with the lanes the
+// error bound cannot certify recomputed exactly, so all ISAs agree bit for bit
+
+static float cross(const Point& o, const Point& a, float px, float py) {
+    return Orientation::cross(o, a, Point{px, py});
+}
+
+// Orientation::errorBound of any point in extent against AB. |left + right| is at most
+// |dx| max|y - a.y| + |dy| max|x - a.x|; the sum is taken in double with a margin far above
+// the float roundings of left and right, and rounded up. Where it overflows the bound is
+// infinite and every vector falls back to the bound of each lane.
+static float callBound(const Point& a, const Point& b, const OrientationKernels::Extent& extent) {
+    const double dx = std::fabs(static_cast<double>(b.x - a.x));
+    const double dy = std::fabs(static_cast<double>(b.y - a.y));
+    const double rangeX = std::max(std::fabs(static_cast<double>(extent.maxX) - a.x),
+                                   std::fabs(static_cast<double>(extent.minX) - a.x));
+    const double rangeY = std::max(std::fabs(static_cast<double>(extent.maxY) - a.y),
+                                   std::fabs(static_cast<double>(extent.minY) - a.y));
+    const double bound = Orientation::ERRBOUND * (dx * rangeY + dy * rangeX) * (1.0 + 0x1p-18)
+                       + 2.0 * std::numeric_limits<float>::denorm_min();
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    if (!(bound < std::numeric_limits<float>::max())) return INF;
+    return std::nextafter(static_cast<float>(bound), INF);
+}
+
+// Recomputes exactly the lanes that neither the call's bound nor their own could certify;
+// kept out of line so the vector loops stay small
+static void certifyLanes(float* lanes, unsigned uncertain, const float* x, const float* y,
+                         const Point& a, const Point& b) {
+    while (uncertain) {
+        const int lane = std::countr_zero(uncertain);
+        lanes[lane] = Orientation::exactCross(a, b, Point{x[lane], y[lane]});
+        uncertain &= uncertain - 1;
+    }
+}
+
+// ---------------------------------------------------------------- scalar
+
+static void signedDistancesScalar(const float* x, const float* y, std::size_t n,
+                                  const Point& a, const Point& b, float* out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = cross(a, b, x[i], y[i]);
+    }
+}
+
+static OrientationKernels::Farthest argmaxDistanceScalar(const float* x, const float* y, std::size_t n,
+                                                         const Point& a, const Point& b,
+                                                         std::size_t start = 0,
+                                                         OrientationKernels::Farthest best = {-1, 0.0f}) {
+    for (std::size_t i = start; i < n; ++i) {
+        const float c = cross(a, b, x[i], y[i]);
+        if (c > best.distance) {
+            best.distance = c;
+            best.index = static_cast<long>(i);
+        }
+    }
+    return best;
+}
+
+static std::size_t partitionBySideScalar(const float* x, const float* y, std::size_t n,
+                                         const Point& a, const Point& b,
+                                         float* outX, float* outY, std::size_t start = 0,
+                                         std::size_t count = 0) {
+    for (std::size_t i = start; i < n; ++i) {
+        if (cross(a, b, x[i], y[i]) > 0.0f) {
+            outX[count] = x[i];
+            outY[count] = y[i];
+            ++count;
+        }
+    }
+    return count;
+}
+
+#ifdef CONVEX_KERNELS_X86
+
+// ---------------------------------------------------------------- SSE2
+
+// The lanes of c at or below the call's bound, against Orientation::errorBound of each lane;
+// out of line, since the vector loops rarely get here
+CONVEX_TARGET("sse2")
+[[gnu::noinline]] static __m128 certifySse2(__m128 c, __m128 left, __m128 right, const float* x, const float* y,
+                                            const Point& a, const Point& b) {
+    const __m128 abs = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 bound = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Orientation::ERRBOUND), _mm_and_ps(_mm_add_ps(left, right), abs)),
+                                    _mm_set1_ps(std::numeric_limits<float>::denorm_min()));
+    const unsigned uncertain = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpngt_ps(_mm_and_ps(c, abs), bound)));
+    if (uncertain == 0) return c;
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, c);
+    certifyLanes(lanes, uncertain, x, y, a, b);
+    return _mm_load_ps(lanes);
+}
+
+// Cross products of the 4 points at x, y against AB (d = B - A). One compare against the
+// call's bound clears almost every vector.
+CONVEX_TARGET("sse2")
+static inline __m128 crossSse2(const float* x, const float* y, __m128 ax, __m128 ay, __m128 dx, __m128 dy,
+                               __m128 bound, const Point& a, const Point& b) {
+    const __m128 left = _mm_mul_ps(dx, _mm_sub_ps(_mm_loadu_ps(y), ay));
+    const __m128 right = _mm_mul_ps(dy, _mm_sub_ps(_mm_loadu_ps(x), ax));
+    const __m128 c = _mm_sub_ps(left, right);
+
+    const __m128 abs = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    if (_mm_movemask_ps(_mm_cmpngt_ps(_mm_and_ps(c, abs), bound)) == 0) return c;
+    return certifySse2(c, left, right, x, y, a, b);
+}
+
+CONVEX_TARGET("sse2")
+static void signedDistancesSse2(const float* x, const float* y, std::size_t n,
+                                const Point& a, const Point& b, float bound, float* out) {
+    const __m128 ax = _mm_set1_ps(a.x);
+    const __m128 ay = _mm_set1_ps(a.y);
+    const __m128 dx = _mm_set1_ps(b.x - a.x);
+    const __m128 dy = _mm_set1_ps(b.y - a.y);
+    const __m128 limit = _mm_set1_ps(bound);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, crossSse2(x + i, y + i, ax, ay, dx, dy, limit, a, b));
+    }
+    signedDistancesScalar(x + i, y + i, n - i, a, b, out + i);
+}
+
+CONVEX_TARGET("sse2")
+static OrientationKernels::Farthest argmaxDistanceSse2(const float* x, const float* y, std::size_t n,
+                                                       const Point& a, const Point& b, float bound) {
+    const __m128 ax = _mm_set1_ps(a.x);
+    const __m128 ay = _mm_set1_ps(a.y);
+    const __m128 dx = _mm_set1_ps(b.x - a.x);
+    const __m128 dy = _mm_set1_ps(b.y - a.y);
+    const __m128 limit = _mm_set1_ps(bound);
+
+    // Every lane keeps its own first maximum; the lanes are reduced afterwards
+    __m128 best = _mm_setzero_ps();
+    __m128i bestIdx = _mm_set1_epi32(-1);
+    __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step = _mm_set1_epi32(4);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 c = crossSse2(x + i, y + i, ax, ay, dx, dy, limit, a, b);
+        const __m128 gt = _mm_cmpgt_ps(c, best);
+        const __m128i gti = _mm_castps_si128(gt);
+        best = _mm_or_ps(_mm_and_ps(gt, c), _mm_andnot_ps(gt, best));
+        bestIdx = _mm_or_si128(_mm_and_si128(gti, idx), _mm_andnot_si128(gti, bestIdx));
+        idx = _mm_add_epi32(idx, step);
+    }
+
+    alignas(16) float lanes[4];
+    alignas(16) std::int32_t laneIdx[4];
+    _mm_store_ps(lanes, best);
+    _mm_store_si128(reinterpret_cast<__m128i*>(laneIdx), bestIdx);
+
+    OrientationKernels::Farthest result{-1, 0.0f};
+    for (int l = 0; l < 4; ++l) {
+        if (laneIdx[l] < 0) continue;
+        if (lanes[l] > result.distance || (lanes[l] == result.distance && laneIdx[l] < result.index)) {
+            result = {laneIdx[l], lanes[l]};
+        }
+    }
+    return argmaxDistanceScalar(x, y, n, a, b, i, result);
+}
+
+CONVEX_TARGET("sse2")
+static std::size_t partitionBySideSse2(const float* x, const float* y, std::size_t n,
+                                       const Point& a, const Point& b, float bound,
+                                       float* outX, float* outY) {
+    const __m128 ax = _mm_set1_ps(a.x);
+    const __m128 ay = _mm_set1_ps(a.y);
+    const __m128 dx = _mm_set1_ps(b.x - a.x);
+    const __m128 dy = _mm_set1_ps(b.y - a.y);
+    const __m128 limit = _mm_set1_ps(bound);
+    const __m128 zero = _mm_setzero_ps();
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 c = crossSse2(x + i, y + i, ax, ay, dx, dy, limit, a, b);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpgt_ps(c, zero)));
+        while (mask) {
+            const int lane = std::countr_zero(mask);
+            outX[count] = x[i + lane];
+            outY[count] = y[i + lane];
+            ++count;
+            mask &= mask - 1;
+        }
+    }
+    return partitionBySideScalar(x, y, n, a, b, outX, outY, i, count);
+}
+
+// ---------------------------------------------------------------- AVX2
+
+// For every 8-bit lane mask: the lane indices of the set bits, packed to the front
+static const std::array<std::array<std::int32_t, 8>, 256> COMPACT_LUT = [] {
+    std::array<std::array<std::int32_t, 8>, 256> lut{};
+    for (unsigned mask = 0; mask < 256; ++mask) {
+        int k = 0;
+        for (int lane = 0; lane < 8; ++lane) {
+            if (mask & (1u << lane)) lut[mask][k++] = lane;
+        }
+    }
+    return lut;
+}();
+
+// STORE_LUT[m] enables the first m lanes of a masked store
+static const std::array<std::array<std::int32_t, 8>, 9> STORE_LUT = [] {
+    std::array<std::array<std::int32_t, 8>, 9> lut{};
+    for (int m = 0; m <= 8; ++m) {
+        for (int lane = 0; lane < m; ++lane) lut[m][lane] = -1;
+    }
+    return lut;
+}();
+
+CONVEX_TARGET("avx2")
+[[gnu::noinline]] static __m256 certifyAvx2(__m256 c, __m256 left, __m256 right, const float* x, const float* y,
+                                            const Point& a, const Point& b) {
+    const __m256 abs = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 bound = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Orientation::ERRBOUND),
+                                                     _mm256_and_ps(_mm256_add_ps(left, right), abs)),
+                                       _mm256_set1_ps(std::numeric_limits<float>::denorm_min()));
+    const unsigned uncertain = static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(c, abs), bound, _CMP_NGT_UQ)));
+    if (uncertain == 0) return c;
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, c);
+    certifyLanes(lanes, uncertain, x, y, a, b);
+    return _mm256_load_ps(lanes);
+}
+
+CONVEX_TARGET("avx2")
+static inline __m256 crossAvx2(const float* x, const float* y, __m256 ax, __m256 ay, __m256 dx, __m256 dy,
+                               __m256 bound, const Point& a, const Point& b) {
+    const __m256 left = _mm256_mul_ps(dx, _mm256_sub_ps(_mm256_loadu_ps(y), ay));
+    const __m256 right = _mm256_mul_ps(dy, _mm256_sub_ps(_mm256_loadu_ps(x), ax));
+    const __m256 c = _mm256_sub_ps(left, right);
+
+    const __m256 abs = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(c, abs), bound, _CMP_NGT_UQ)) == 0) return c;
+    return certifyAvx2(c, left, right, x, y, a, b);
+}
+
+CONVEX_TARGET("avx2")
+static void signedDistancesAvx2(const float* x, const float* y, std::size_t n,
+                                const Point& a, const Point& b, float bound, float* out) {
+    const __m256 ax = _mm256_set1_ps(a.x);
+    const __m256 ay = _mm256_set1_ps(a.y);
+    const __m256 dx = _mm256_set1_ps(b.x - a.x);
+    const __m256 dy = _mm256_set1_ps(b.y - a.y);
+    const __m256 limit = _mm256_set1_ps(bound);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, crossAvx2(x + i, y + i, ax, ay, dx, dy, limit, a, b));
+    }
+    signedDistancesScalar(x + i, y + i, n - i, a, b, out + i);
+}
+
+CONVEX_TARGET("avx2")
+static OrientationKernels::Farthest argmaxDistanceAvx2(const float* x, const float* y, std::size_t n,
+                                                       const Point& a, const Point& b, float bound) {
+    const __m256 ax = _mm256_set1_ps(a.x);
+    const __m256 ay = _mm256_set1_ps(a.y);
+    const __m256 dx = _mm256_set1_ps(b.x - a.x);
+    const __m256 dy = _mm256_set1_ps(b.y - a.y);
+    const __m256 limit = _mm256_set1_ps(bound);
+
+    __m256 best = _mm256_setzero_ps();
+    __m256i bestIdx = _mm256_set1_epi32(-1);
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 c = crossAvx2(x + i, y + i, ax, ay, dx, dy, limit, a, b);
+        const __m256 gt = _mm256_cmp_ps(c, best, _CMP_GT_OQ);
+        best = _mm256_blendv_ps(best, c, gt);
+        bestIdx = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(bestIdx),
+                                                       _mm256_castsi256_ps(idx), gt));
+        idx = _mm256_add_epi32(idx, step);
+    }
+
+    alignas(32) float lanes[8];
+    alignas(32) std::int32_t laneIdx[8];
+    _mm256_store_ps(lanes, best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(laneIdx), bestIdx);
+
+    OrientationKernels::Farthest result{-1, 0.0f};
+    for (int l = 0; l < 8; ++l) {
+        if (laneIdx[l] < 0) continue;
+        if (lanes[l] > result.distance || (lanes[l] == result.distance && laneIdx[l] < result.index)) {
+            result = {laneIdx[l], lanes[l]};
+        }
+    }
+    return argmaxDistanceScalar(x, y, n, a, b, i, result);
+}
+
+CONVEX_TARGET("avx2")
+static std::size_t partitionBySideAvx2(const float* x, const float* y, std::size_t n,
+                                       const Point& a, const Point& b, float bound,
+                                       float* outX, float* outY) {
+    const __m256 ax = _mm256_set1_ps(a.x);
+    const __m256 ay = _mm256_set1_ps(a.y);
+    const __m256 dx = _mm256_set1_ps(b.x - a.x);
+    const __m256 dy = _mm256_set1_ps(b.y - a.y);
+    const __m256 limit = _mm256_set1_ps(bound);
+    const __m256 zero = _mm256_setzero_ps();
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 c = crossAvx2(x + i, y + i, ax, ay, dx, dy, limit, a, b);
+        const __m256 px = _mm256_loadu_ps(x + i);
+        const __m256 py = _mm256_loadu_ps(y + i);
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(c, zero, _CMP_GT_OQ)));
+        if (mask == 0) continue;
+
+        // Pack the selected lanes to the front and store only those, never past the result
+        const __m256i perm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(COMPACT_LUT[mask].data()));
+        const int selected = std::popcount(mask);
+        const __m256i store = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(STORE_LUT[selected].data()));
+        _mm256_maskstore_ps(outX + count, store, _mm256_permutevar8x32_ps(px, perm));
+        _mm256_maskstore_ps(outY + count, store, _mm256_permutevar8x32_ps(py, perm));
+        count += static_cast<std::size_t>(selected);
+    }
+    return partitionBySideScalar(x, y, n, a, b, outX, outY, i, count);
+}
+
+#endif // CONVEX_KERNELS_X86
+
+// ---------------------------------------------------------------- dispatch
+
+OrientationKernels::Isa OrientationKernels::detectIsa() {
+#if defined(CONVEX_KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+    if (__builtin_cpu_supports("sse2")) return Isa::SSE2;
+#elif defined(CONVEX_KERNELS_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    const bool sse2 = (info[3] & (1 << 26)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    // AVX2 also needs the OS to save the YMM registers
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) return Isa::AVX2;
+    }
+    if (sse2) return Isa::SSE2;
+#endif
+    return Isa::SCALAR;
+}
+
+static std::atomic<OrientationKernels::Isa>& activeIsa() {
+    static std::atomic<OrientationKernels::Isa> isa{OrientationKernels::detectIsa()};
+    return isa;
+}
+
+OrientationKernels::Isa OrientationKernels::getIsa() {
+    return activeIsa().load(std::memory_order_relaxed);
+}
+
+void OrientationKernels::setIsa(Isa isa) {
+    const Isa supported = detectIsa();
+    activeIsa().store(static_cast<int>(isa) <= static_cast<int>(supported) ? isa : supported);
+}
+
+const char* OrientationKernels::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2: return "avx2";
+        case Isa::SSE2: return "sse2";
+        default:        return "scalar";
+    }
+}
+
+OrientationKernels::Extent OrientationKernels::extentOf(const float* x, const float* y, std::size_t n) {
+    if (n == 0) return {0, 0, 0, 0};
+    Extent extent{x[0], y[0], x[0], y[0]};
+    for (std::size_t i = 1; i < n; ++i) {
+        extent.minX = std::min(extent.minX, x[i]);
+        extent.minY = std::min(extent.minY, y[i]);
+        extent.maxX = std::max(extent.maxX, x[i]);
+        extent.maxY = std::max(extent.maxY, y[i]);
+    }
+    return extent;
+}
+
+void OrientationKernels::signedDistances(const float* x, const float* y, std::size_t n,
+                                         const Point& a, const Point& b, float* out) {
+    signedDistances(x, y, n, a, b, extentOf(x, y, n), out);
+}
+
+void OrientationKernels::signedDistances(const float* x, const float* y, std::size_t n,
+                                         const Point& a, const Point& b, const Extent& extent, float* out) {
+#ifdef CONVEX_KERNELS_X86
+    switch (getIsa()) {
+        case Isa::AVX2: return signedDistancesAvx2(x, y, n, a, b, callBound(a, b, extent), out);
+        case Isa::SSE2: return signedDistancesSse2(x, y, n, a, b, callBound(a, b, extent), out);
+        default: break;
+    }
+#endif
+    signedDistancesScalar(x, y, n, a, b, out);
+}
+
+OrientationKernels::Farthest OrientationKernels::argmaxDistance(const float* x, const float* y, std::size_t n,
+                                                                const Point& a, const Point& b) {
+    return argmaxDistance(x, y, n, a, b, extentOf(x, y, n));
+}
+
+OrientationKernels::Farthest OrientationKernels::argmaxDistance(const float* x, const float* y, std::size_t n,
+                                                                const Point& a, const Point& b,
+                                                                const Extent& extent) {
+    Farthest result{-1, 0.0f};
+#ifdef CONVEX_KERNELS_X86
+    // Lane indices are 32-bit; larger inputs take the scalar path
+    const bool fitsLanes = n <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+    if (fitsLanes && getIsa() == Isa::AVX2) {
+        result = argmaxDistanceAvx2(x, y, n, a, b, callBound(a, b, extent));
+    } else if (fitsLanes && getIsa() == Isa::SSE2) {
+        result = argmaxDistanceSse2(x, y, n, a, b, callBound(a, b, extent));
+    } else {
+        result = argmaxDistanceScalar(x, y, n, a, b);
+    }
+#else
+    result = argmaxDistanceScalar(x, y, n, a, b);
+#endif
+    if (result.index < 0) result.distance = 0.0f;
+    return result;
+}
+
+std::size_t OrientationKernels::partitionBySide(const float* x, const float* y, std::size_t n,
+                                                const Point& a, const Point& b,
+                                                float* outX, float* outY) {
+    return partitionBySide(x, y, n, a, b, extentOf(x, y, n), outX, outY);
+}
+
+std::size_t OrientationKernels::partitionBySide(const float* x, const float* y, std::size_t n,
+                                                const Point& a, const Point& b, const Extent& extent,
+                                                float* outX, float* outY) {
+#ifdef CONVEX_KERNELS_X86
+    switch (getIsa()) {
+        case Isa::AVX2: return partitionBySideAvx2(x, y, n, a, b, callBound(a, b, extent), outX, outY);
+        case Isa::SSE2: return partitionBySideSse2(x, y, n, a, b, callBound(a, b, extent), outX, outY);
+        default: break;
+    }
+#endif
+    return partitionBySideScalar(x, y, n, a, b, outX, outY);
+}
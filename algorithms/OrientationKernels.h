@@ -0,0 +1,63 @@
+#ifndef ORIENTATIONKERNELS_H
+#define ORIENTATIONKERNELS_H
+
+#include <cstddef>
+#include "point_providers/Point.h"
+
+// Vectorized orientation kernels over structure-of-arrays coordinates.
+// The cross product is Orientation::cross: the same float operations as the scalar
+// algorithms, with uncertain lanes recomputed exactly, so every implementation returns
+// bit-identical results and exact signs. The vector loops test every lane against one
+// error bound for the whole call, derived from AB and the extent of the input; only the
+// lanes below it go through the scalar predicate.
+// The implementation is picked at runtime from what the CPU supports.
+class OrientationKernels {
+public:
+    enum class Isa { SCALAR, SSE2, AVX2 };
+
+    struct Farthest {
+        long index;      // -1 if no point is strictly left of the line
+        float distance;  // cross product magnitude of the farthest point
+    };
+
+    // A box containing every input point. Callers that know one pass it on; the overloads
+    // without it compute it with an extra pass over the input.
+    struct Extent {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    static Extent extentOf(const float* x, const float* y, std::size_t n);
+
+    // out[i] = cross(a, b, p_i); positive means p_i lies left of AB
+    static void signedDistances(const float* x, const float* y, std::size_t n,
+                                const Point& a, const Point& b, float* out);
+    static void signedDistances(const float* x, const float* y, std::size_t n,
+                                const Point& a, const Point& b, const Extent& extent, float* out);
+
+    // Farthest point strictly left of AB (cross > 0); ties resolve to the lowest index
+    static Farthest argmaxDistance(const float* x, const float* y, std::size_t n,
+                                   const Point& a, const Point& b);
+    static Farthest argmaxDistance(const float* x, const float* y, std::size_t n,
+                                   const Point& a, const Point& b, const Extent& extent);
+
+    // Copies the points strictly left of AB to outX/outY (keeping their order) and returns
+    // their count. Nothing past the returned count is written, but the outputs need room
+    // for n values in the worst case and must not alias the input.
+    static std::size_t partitionBySide(const float* x, const float* y, std::size_t n,
+                                       const Point& a, const Point& b,
+                                       float* outX, float* outY);
+    static std::size_t partitionBySide(const float* x, const float* y, std::size_t n,
+                                       const Point& a, const Point& b, const Extent& extent,
+                                       float* outX, float* outY);
+
+    static Isa detectIsa();
+    static Isa getIsa();
+    // Force an implementation (for tests and benchmarks); clamped to what the CPU supports
+    static void setIsa(Isa isa);
+    static const char* isaName(Isa isa);
+};
+
+#endif //ORIENTATIONKERNELS_H
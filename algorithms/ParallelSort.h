@@ -0,0 +1,69 @@
+#ifndef PARALLELSORT_H
+#define PARALLELSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "WorkStealingPool.h"
+
+// Parallel merge sort: blocks are sorted with std::sort as pool tasks, then adjacent
+// runs are merged pairwise (also in parallel) between the input and one scratch buffer.
+template <class T, class Compare>
+void parallelSort(std::vector<T>& data, Compare comp, WorkStealingPool& pool,
+                  std::size_t minBlock = std::size_t{1} << 15) {
+    const std::size_t n = data.size();
+    const std::size_t maxBlocks = static_cast<std::size_t>(pool.getThreadCount()) * 2;
+    const std::size_t blocks = std::max<std::size_t>(1, std::min(n / minBlock, maxBlocks));
+
+    if (blocks == 1) {
+        std::sort(data.begin(), data.end(), comp);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(blocks + 1);
+    for (std::size_t b = 0; b <= blocks; ++b) {
+        bounds[b] = n * b / blocks;
+    }
+
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        for (std::size_t b = 0; b < blocks; ++b) {
+            group.run([&, b] {
+                std::sort(data.begin() + bounds[b], data.begin() + bounds[b + 1], comp);
+            });
+        }
+        group.wait();
+    }
+
+    std::vector<T> scratch(n);
+    std::vector<T>* src = &data;
+    std::vector<T>* dst = &scratch;
+
+    while (bounds.size() > 2) {
+        std::vector<std::size_t> merged;
+        merged.push_back(0);
+        {
+            WorkStealingPool::TaskGroup group(pool);
+            for (std::size_t r = 0; r + 1 < bounds.size(); r += 2) {
+                const std::size_t begin = bounds[r];
+                const std::size_t mid = bounds[r + 1];
+                const std::size_t end = r + 2 < bounds.size() ? bounds[r + 2] : mid;
+                group.run([=, &comp] {
+                    std::merge(src->begin() + begin, src->begin() + mid,
+                               src->begin() + mid, src->begin() + end,
+                               dst->begin() + begin, comp);
+                });
+                merged.push_back(end);
+            }
+            group.wait();
+        }
+        bounds = std::move(merged);
+        std::swap(src, dst);
+    }
+
+    if (src != &data) {
+        data.swap(scratch);
+    }
+}
+
+#endif //PARALLELSORT_H
@@ -1,26 +1,34 @@
 #include "algorithms/QuickhullAlgorithm.h"
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/Orientation.h"
+#include "algorithms/OrientationKernels.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
-constexpr double EPS = 1e-9; // Small epsilon to handle floating-point precision errors
+// Parallel mode: subsets below this size are handed to the serial recursion,
+// and linear scans are split into chunks of at least this many points
+constexpr size_t PARALLEL_CUTOFF = 1 << 14;
 
 // Constructor: initialize the algorithm with a set of points
-QuickHullAlgorithm::QuickHullAlgorithm(const std::vector<Point>& points) {
+template <class T>
+BasicQuickHullAlgorithm<T>::BasicQuickHullAlgorithm(const std::vector<PointType>& points) {
     reset(points);
 }
 
 // Reset the algorithm's internal state for a new convex hull computation
-void QuickHullAlgorithm::reset(const std::vector<Point>& points) {
+template <class T>
+void BasicQuickHullAlgorithm<T>::reset(const std::vector<PointType>& points) {
     // Copy input points
     m_points = points;
 
     // Clear all internal data structures
     m_hull.clear();
+    m_hullNodes.clear();
     m_tasks.clear();
-    m_currentLevelTasks.clear();
+    m_stepPoints.clear();
     m_currentFarthestPoints.clear();
-    m_activePoints.clear();
-    m_pendingTasks.clear();
+    m_pointStates.assign(m_points.size(), PointState::INACTIVE);
 
     // Reset flags
     m_finished = false;
@@ -30,249 +38,321 @@ void QuickHullAlgorithm::reset(const std::vector<Point>& points) {
     // If there are fewer than 3 points, the hull is just the points themselves
     if (m_points.size() < 3) {
         m_hull = m_points;
+        m_pointStates.assign(m_points.size(), PointState::HULL);
+        m_finished = true;
+        return;
+    }
+
+    // The step mode tracks points by 32-bit index; larger inputs are computed in one go
+    if (m_points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        m_hull = runCompleteAlgorithm(m_points);
         m_finished = true;
         return;
     }
 
     // Start main setup
     initialize();
-    updateActivePoints();
 }
 
-// Compute 2D cross product (OA × OB). Positive if B is to the left of OA.
-float QuickHullAlgorithm::cross(const Point& o, const Point& a, const Point& b) {
-    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+// Compute 2D cross product (OA × OB). Positive if B is to the left of OA; the sign is exact.
+template <class T>
+typename BasicQuickHullAlgorithm<T>::Cross BasicQuickHullAlgorithm<T>::cross(const PointType& o, const PointType& a, const PointType& b) {
+    return Orientation::cross(o, a, b);
 }
 
 // Compute perpendicular distance from point p to line segment AB using cross product magnitude
-float QuickHullAlgorithm::distanceToLine(const Point& a, const Point& b, const Point& p) {
-    return std::fabs(cross(a, b, p));
+template <class T>
+typename BasicQuickHullAlgorithm<T>::Cross BasicQuickHullAlgorithm<T>::distanceToLine(const PointType& a, const PointType& b, const PointType& p) {
+    const Cross c = cross(a, b, p);
+    return c < 0 ? -c : c;
+}
+
+// The farthest point is picked by its float distance, so when distances tie within rounding
+// a point that is not a vertex can be added. Every vertex is still in the result, which is
+// then rebuilt with Andrew's exact chains in this algorithm's layout (leftmost point first,
+// clockwise). A strictly convex result, the normal case, is left untouched.
+// E is a point or an indexed point, pointOf reads its coordinates
+template <class E, class PointOf>
+static bool isStrictlyClockwise(const std::vector<E>& hull, PointOf pointOf) {
+    const size_t h = hull.size();
+    for (size_t i = 0; i < h; ++i) {
+        if (Orientation::sign(pointOf(hull[i]), pointOf(hull[(i + 1) % h]), pointOf(hull[(i + 2) % h])) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class T>
+void BasicQuickHullAlgorithm<T>::repairHull(std::vector<PointType>& hull) {
+    Workspace workspace;
+    repairHull(hull, workspace);
+}
+
+// The rebuild goes through the workspace, whose points are free once the recursion is done
+template <class T>
+void BasicQuickHullAlgorithm<T>::repairHull(std::vector<PointType>& hull, Workspace& workspace) {
+    if (hull.size() < 3 || isStrictlyClockwise(hull, [](const PointType& p) -> const PointType& { return p; })) {
+        return;
+    }
+
+    std::vector<PointType>& rebuilt = workspace.points;
+    BasicAndrewAlgorithm<T>::computeHull(hull, rebuilt, workspace.andrew);
+    std::reverse(rebuilt.begin() + 1, rebuilt.end());
+    hull.assign(rebuilt.begin(), rebuilt.end());
+}
+
+// Index mode counterpart: the rebuild runs Andrew's index mode over the hull's points
+template <class T>
+void BasicQuickHullAlgorithm<T>::repairHull(std::vector<IndexedPoint>& hull, Workspace& workspace) {
+    if (hull.size() < 3 || isStrictlyClockwise(hull, [](const IndexedPoint& e) -> const PointType& { return e.point; })) {
+        return;
+    }
+
+    std::vector<PointType>& points = workspace.points;
+    points.clear();
+    for (const IndexedPoint& e : hull) {
+        points.push_back(e.point);
+    }
+    std::vector<std::uint32_t>& vertices = workspace.rebuilt;
+    BasicAndrewAlgorithm<T>::computeHullIndices(points, vertices, workspace.andrew);
+
+    std::vector<IndexedPoint>& rebuilt = workspace.indexed;
+    rebuilt.clear();
+    for (const std::uint32_t v : vertices) {
+        rebuilt.push_back(hull[v]);
+    }
+    std::reverse(rebuilt.begin() + 1, rebuilt.end());
+    hull.assign(rebuilt.begin(), rebuilt.end());
 }
 
 // Collect points that lie on one specific side (left or right) of a line AB
-std::vector<Point> QuickHullAlgorithm::getPointsOnSide(const Point& a, const Point& b,
-                                                        const std::vector<Point>& points, bool left) {
-    std::vector<Point> result;
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::getPointsOnSide(const PointType& a, const PointType& b,
+                                                                       std::span<const PointType> points, bool left) {
+    std::vector<PointType> result;
     for (const auto& p : points) {
-        float c = cross(a, b, p);
+        const Cross c = cross(a, b, p);
         // Positive cross -> left side, negative -> right side
-        if (left && c > EPS) {
+        if (left && c > 0) {
             result.push_back(p);
-        } else if (!left && c < -EPS) {
+        } else if (!left && c < 0) {
             result.push_back(p);
         }
     }
     return result;
 }
 
+// Index of the point farthest left of AB (first one on ties), -1 if none is strictly left
+template <class T>
+int BasicQuickHullAlgorithm<T>::findFarthest(const PointType& a, const PointType& b, std::span<const PointType> points) {
+    int   idx = -1;
+    Cross maxDist = 0;
+    for (int i = 0; i < static_cast<int>(points.size()); ++i) {
+        if (cross(a, b, points[i]) > 0) {
+            const Cross d = distanceToLine(a, b, points[i]);
+            if (d > maxDist) {
+                maxDist = d;
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
 // Initialization: find the two extreme points (leftmost and rightmost) and start recursive hull tasks
-void QuickHullAlgorithm::initialize() {
+template <class T>
+void BasicQuickHullAlgorithm<T>::initialize() {
     // Find the leftmost point (minimum x, then minimum y)
     auto minIt = std::min_element(m_points.begin(), m_points.end(),
-        [](const Point& a, const Point& b) { return (a.x < b.x) || (a.x == b.x && a.y < b.y); });
+        [](const PointType& a, const PointType& b) { return (a.x < b.x) || (a.x == b.x && a.y < b.y); });
     // Find the rightmost point (maximum x, then maximum y)
     auto maxIt = std::max_element(m_points.begin(), m_points.end(),
-        [](const Point& a, const Point& b) { return (a.x < b.x) || (a.x == b.x && a.y < b.y); });
-
-    Point leftmost = *minIt;
-    Point rightmost = *maxIt;
-
-    // Start the hull with the two extreme points
-    m_hull.push_back(leftmost);
-    m_hull.push_back(rightmost);
-
-    // Split the remaining points into those above and below the line
-    std::vector<Point> upperSet = getPointsOnSide(leftmost, rightmost, m_points, true);
-    std::vector<Point> lowerSet = getPointsOnSide(leftmost, rightmost, m_points, false);
+        [](const PointType& a, const PointType& b) { return (a.x < b.x) || (a.x == b.x && a.y < b.y); });
+
+    PointType leftmost = *minIt;
+    PointType rightmost = *maxIt;
+
+    // Start the hull with the two extreme points, linked into a cycle
+    m_hullNodes.push_back({leftmost, 1});
+    m_hullNodes.push_back({rightmost, 0});
+    m_pointStates[minIt - m_points.begin()] = PointState::HULL;
+    m_pointStates[maxIt - m_points.begin()] = PointState::HULL;
+
+    // Split the remaining points into those above and below the line: the upper set
+    // goes to the front of the working set, the lower one after it, both in input order
+    m_stepScratch.clear();
+    for (size_t i = 0; i < m_points.size(); ++i) {
+        const IndexedPoint e{m_points[i], static_cast<std::uint32_t>(i)};
+        const Cross c = cross(leftmost, rightmost, e.point);
+        if (c > 0) {
+            m_stepPoints.push_back(e);
+        } else if (c < 0) {
+            m_stepScratch.push_back(e);
+        } else {
+            continue;
+        }
+        m_pointStates[i] = PointState::ACTIVE;
+    }
+    const size_t upperEnd = m_stepPoints.size();
+    m_stepPoints.insert(m_stepPoints.end(), m_stepScratch.begin(), m_stepScratch.end());
 
     // Each subset becomes a recursive task (upper and lower hull)
-    if (!upperSet.empty()) {
-        m_tasks.push_back({leftmost, rightmost, upperSet, 1});
+    if (upperEnd > 0) {
+        m_tasks.push_back({leftmost, rightmost, 0, upperEnd, upperEnd, 0});
     }
-    if (!lowerSet.empty()) {
-        m_tasks.push_back({rightmost, leftmost, lowerSet, static_cast<int>(m_hull.size())});
+    if (upperEnd < m_stepPoints.size()) {
+        m_tasks.push_back({rightmost, leftmost, upperEnd, m_stepPoints.size(), m_stepPoints.size(), 1});
     }
 
     // If no subsets exist, the hull is just the two points
     if (m_tasks.empty()) {
+        m_hull = materializeHull();
         m_finished = true;
     }
 }
 
-// Update the collection of all currently active points (used for visualization/debug info)
-void QuickHullAlgorithm::updateActivePoints() {
-    m_activePoints.clear();
-
-    // Include all points currently on the hull
-    for (const auto& p : m_hull) {
-        m_activePoints.insert(p);
-    }
-
-    // Include points currently being processed in queued tasks
-    for (const auto& task : m_tasks) {
-        for (const auto& p : task.set) {
-            m_activePoints.insert(p);
-        }
-    }
-
-    // Include points in the current preview level
-    for (const auto& task : m_currentLevelTasks) {
-        for (const auto& p : task.set) {
-            m_activePoints.insert(p);
-        }
-    }
-}
-
 // Compute a "preview" step – find farthest points for each active task (for stepwise visualization)
-void QuickHullAlgorithm::computePreview() {
+template <class T>
+void BasicQuickHullAlgorithm<T>::computePreview() {
     if (m_tasks.empty()) {
         // No more tasks -> algorithm is done
-        m_finished = true;
-        m_currentLevelTasks.clear();
+        if (!m_finished) {
+            m_hull = materializeHull();
+            m_finished = true;
+        }
         m_currentFarthestPoints.clear();
         m_inPreviewPhase = false;
         return;
     }
 
-    // Copy current tasks into preview containers
-    const size_t currentLevelSize = m_tasks.size();
-    m_currentLevelTasks.clear();
-    m_pendingTasks.clear();
-    for (size_t i = 0; i < currentLevelSize; ++i) {
-        m_currentLevelTasks.push_back(m_tasks[i]);
-        m_pendingTasks.push_back(m_tasks[i]);
-    }
-
     m_currentFarthestPoints.clear();
 
-    // For each active task, find the farthest point from the segment AB
-    for (const auto& task : m_currentLevelTasks) {
-        float maxDist = 0.0f;
-        bool found = false;
-        Point farthest;
+    // For each active task, find the farthest point from the segment AB; the commit
+    // reuses its position
+    for (auto& task : m_tasks) {
+        Cross maxDist = 0;
+        task.farthest = task.end;
 
         // Iterate through all points in this subset
-        for (const auto& p : task.set) {
-            float c = cross(task.a, task.b, p);
-            if (c > EPS) { // Point is on the left side
-                float d = distanceToLine(task.a, task.b, p);
+        for (size_t i = task.begin; i < task.end; ++i) {
+            const PointType& p = m_stepPoints[i].point;
+            const Cross c = cross(task.a, task.b, p);
+            if (c > 0) { // Point is on the left side
+                const Cross d = distanceToLine(task.a, task.b, p);
                 if (d > maxDist) {
                     maxDist = d;
-                    farthest = p;
-                    found = true;
+                    task.farthest = i;
                 }
             }
         }
 
         // Save farthest point for visualization
-        if (found) {
-            m_currentFarthestPoints.push_back(farthest);
+        if (task.farthest != task.end) {
+            m_currentFarthestPoints.push_back(m_stepPoints[task.farthest].point);
         }
     }
 
     m_inPreviewPhase = true;
 }
 
-// Commit the results from the preview step (actually modify the hull and update tasks)
-void QuickHullAlgorithm::commitPreview() {
-    if (m_pendingTasks.empty()) {
+// Commit the results from the preview step (actually modify the hull and update tasks).
+// Only the points of the committed tasks are touched: each range is split in place into
+// the ranges of its subtasks and the points that drop out are marked inactive.
+template <class T>
+void BasicQuickHullAlgorithm<T>::commitPreview() {
+    if (!m_inPreviewPhase) {
         // Nothing to process
-        m_inPreviewPhase = false;
         return;
     }
 
-    std::deque<Task> nextLevelTasks; // Tasks for the next recursion level
+    std::vector<Task> nextLevelTasks; // Tasks for the next recursion level
 
-    const size_t toProcess = m_pendingTasks.size();
-    for (size_t i = 0; i < toProcess; ++i) {
+    for (size_t i = 0; i < m_tasks.size(); ++i) {
         // Process one active task
-        Task task = m_tasks.front();
-        m_tasks.pop_front();
-
-        // Find the farthest point from segment AB (strictly on left side)
-        int idx = -1;
-        float maxDist = 0.0f;
-        for (int j = 0; j < static_cast<int>(task.set.size()); ++j) {
-            float c = cross(task.a, task.b, task.set[j]);
-            if (c > EPS) {
-                float d = distanceToLine(task.a, task.b, task.set[j]);
-                if (d > maxDist) {
-                    maxDist = d;
-                    idx = j;
-                }
-            }
-        }
+        const Task task = m_tasks[i];
 
         // If no points left of AB, nothing more to process on this branch
-        if (idx < 0) {
+        if (task.farthest == task.end) {
+            for (size_t j = task.begin; j < task.end; ++j) {
+                m_pointStates[m_stepPoints[j].index] = PointState::INACTIVE;
+            }
             continue;
         }
 
-        const Point farthest = task.set[idx]; // Farthest point from AB
-
-        // Insert the farthest point into the hull at the correct position
-        m_hull.insert(m_hull.begin() + task.insertPos, farthest);
-
-        // Adjust insertion indices for all other tasks
-        for (auto& t : m_tasks) {
-            if (t.insertPos >= task.insertPos) t.insertPos++;
-        }
-        for (auto& t : nextLevelTasks) {
-            if (t.insertPos >= task.insertPos) t.insertPos++;
-        }
-
-        // Split the remaining points into two subsets:
-        //   s1 -> points to the left of (A, farthest)
-        //   s2 -> points to the left of (farthest, B)
-        std::vector<Point> s1;
-        std::vector<Point> s2;
-        s1.reserve(task.set.size());
-        s2.reserve(task.set.size());
-
-        for (const auto& q : task.set) {
-            // Skip duplicates and endpoints
-            if ((q.x == farthest.x && q.y == farthest.y) ||
-                (q.x == task.a.x && q.y == task.a.y) ||
-                (q.x == task.b.x && q.y == task.b.y)) {
-                continue;
-            }
-            if (cross(task.a, farthest, q) > EPS) {
-                s1.push_back(q);
-            } else if (cross(farthest, task.b, q) > EPS) {
-                s2.push_back(q);
+        const IndexedPoint farthest = m_stepPoints[task.farthest]; // Farthest point from AB
+
+        // Link the farthest point into the hull between A and B
+        const size_t node = m_hullNodes.size();
+        m_hullNodes.push_back({farthest.point, m_hullNodes[task.edge].next});
+        m_hullNodes[task.edge].next = node;
+
+        // Split the remaining points into two subsets, keeping their order:
+        //   s1 -> points to the left of (A, farthest), compacted to the front of the range
+        //   s2 -> points to the left of (farthest, B), parked in the scratch buffer
+        // The range only holds points strictly left of AB, so none of them equals A or B
+        size_t s1End = task.begin;
+        m_stepScratch.clear();
+        for (size_t j = task.begin; j < task.end; ++j) {
+            const IndexedPoint q = m_stepPoints[j];
+            // Skip duplicates of the farthest point
+            if (q.point.x == farthest.point.x && q.point.y == farthest.point.y) {
+                m_pointStates[q.index] = PointState::INACTIVE;
+            } else if (cross(task.a, farthest.point, q.point) > 0) {
+                m_stepPoints[s1End++] = q;
+            } else if (cross(farthest.point, task.b, q.point) > 0) {
+                m_stepScratch.push_back(q);
+            } else {
+                m_pointStates[q.index] = PointState::INACTIVE;
             }
         }
+        m_pointStates[farthest.index] = PointState::HULL;
+        const size_t s2End = s1End + m_stepScratch.size();
+        std::copy(m_stepScratch.begin(), m_stepScratch.end(), m_stepPoints.begin() + s1End);
 
         // Schedule new tasks for both subsets
-        if (!s1.empty()) {
-            nextLevelTasks.push_back({task.a, farthest, std::move(s1), task.insertPos});
+        if (s1End > task.begin) {
+            nextLevelTasks.push_back({task.a, farthest.point, task.begin, s1End, s1End, task.edge});
         }
-        if (!s2.empty()) {
-            nextLevelTasks.push_back({farthest, task.b, std::move(s2), task.insertPos + 1});
+        if (s2End > s1End) {
+            nextLevelTasks.push_back({farthest.point, task.b, s1End, s2End, s2End, node});
         }
     }
 
-    // Append all generated next-level tasks
-    for (const auto& task : nextLevelTasks) {
-        m_tasks.push_back(task);
-    }
+    // The next level replaces the committed one
+    m_tasks.swap(nextLevelTasks);
 
     // Clear preview-related data
-    m_pendingTasks.clear();
-    m_currentLevelTasks.clear();
     m_currentFarthestPoints.clear();
     m_inPreviewPhase = false;
 
     // If no more tasks exist, hull is fully computed
     if (m_tasks.empty()) {
+        m_hull = materializeHull();
+        repairHull(m_hull);
         m_finished = true;
     }
+}
 
-    updateActivePoints();
+// Walk the linked hull from the leftmost point
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::materializeHull() const {
+    std::vector<PointType> hull;
+    if (m_hullNodes.empty()) {
+        return hull;
+    }
+    hull.reserve(m_hullNodes.size());
+    size_t node = 0;
+    do {
+        hull.push_back(m_hullNodes[node].point);
+        node = m_hullNodes[node].next;
+    } while (node != 0);
+    return hull;
 }
 
 // Perform one step of the interactive algorithm (toggle between preview and commit)
-bool QuickHullAlgorithm::step() {
+template <class T>
+bool BasicQuickHullAlgorithm<T>::step() {
     if (m_finished) {
         return false;
     }
@@ -286,56 +366,70 @@ bool QuickHullAlgorithm::step() {
         // Actually add the farthest points and create new tasks
         commitPreview();
         m_phase = Phase::PREVIEW;
-        updateActivePoints();
         return !m_finished;
     }
 }
 
 // Return all currently active segment pairs (edges under consideration)
-std::vector<std::pair<Point, Point>> QuickHullAlgorithm::getActiveSegments() const {
-    std::vector<std::pair<Point, Point>> segments;
-    for (const auto& task : m_currentLevelTasks) {
+template <class T>
+std::vector<std::pair<BasicPoint<T>, BasicPoint<T>>> BasicQuickHullAlgorithm<T>::getActiveSegments() const {
+    std::vector<std::pair<PointType, PointType>> segments;
+    if (!m_inPreviewPhase) {
+        return segments;
+    }
+    for (const auto& task : m_tasks) {
         segments.push_back({task.a, task.b});
     }
     return segments;
 }
 
 // Return all candidate points currently being evaluated
-std::vector<Point> QuickHullAlgorithm::getCandidatePoints() const {
-    std::vector<Point> candidates;
-    for (const auto& task : m_currentLevelTasks) {
-        for (const auto& p : task.set) {
-            candidates.push_back(p);
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::getCandidatePoints() const {
+    std::vector<PointType> candidates;
+    if (!m_inPreviewPhase) {
+        return candidates;
+    }
+    for (const auto& task : m_tasks) {
+        for (size_t i = task.begin; i < task.end; ++i) {
+            candidates.push_back(m_stepPoints[i].point);
         }
     }
     return candidates;
 }
 
 // Return farthest points found in the current preview
-std::vector<Point> QuickHullAlgorithm::getFarthestPoints() const {
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::getFarthestPoints() const {
     return m_currentFarthestPoints;
 }
 
-// Return all points considered "active" in the current state
-std::set<Point> QuickHullAlgorithm::getActivePoints() const {
-    return m_activePoints;
-}
-
 // Check if the convex hull computation is complete
-bool QuickHullAlgorithm::isFinished() const {
+template <class T>
+bool BasicQuickHullAlgorithm<T>::isFinished() const {
     return m_finished;
 }
 
 // Return the current state of the hull (partial or complete)
-std::vector<Point> QuickHullAlgorithm::getCurrentHull() {
-    return m_hull;
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::getCurrentHull() {
+    return m_finished ? m_hull : materializeHull();
 }
 
 // Compute the full convex hull non-interactively (direct recursive QuickHull)
-std::vector<Point> QuickHullAlgorithm::runCompleteAlgorithm(const std::vector<Point>& points) {
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::runCompleteAlgorithm(const std::vector<PointType>& points) {
     if (points.size() < 3) return points;
+    if (m_pool) return runParallel(points);
+    return runCompleteAlgorithm(std::span<const PointType>(points));
+}
+
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::runCompleteAlgorithm(std::span<const PointType> points) {
+    if (points.size() < 3) return {points.begin(), points.end()};
+    if (m_pool) return runParallel({points.begin(), points.end()});
 
-    auto lessXY = [](const Point& a, const Point& b) {
+    auto lessXY = [](const PointType& a, const PointType& b) {
         if (a.x != b.x) return a.x < b.x;
         return a.y < b.y;
     };
@@ -343,62 +437,443 @@ std::vector<Point> QuickHullAlgorithm::runCompleteAlgorithm(const std::vector<Po
     const auto minIt = std::min_element(points.begin(), points.end(), lessXY);
     const auto maxIt = std::max_element(points.begin(), points.end(), lessXY);
 
-    const Point leftmost  = *minIt;
-    const Point rightmost = *maxIt;
+    const PointType leftmost  = *minIt;
+    const PointType rightmost = *maxIt;
 
-    const std::vector<Point> upperSet = getPointsOnSide(leftmost, rightmost, points, true);
-    const std::vector<Point> lowerSet = getPointsOnSide(leftmost, rightmost, points, false);
+    const std::vector<PointType> upperSet = getPointsOnSide(leftmost, rightmost, points, true);
+    const std::vector<PointType> lowerSet = getPointsOnSide(leftmost, rightmost, points, false);
 
-    std::vector<Point> hull;
+    std::vector<PointType> hull;
     hull.reserve(points.size());
     hull.push_back(leftmost);
     quickHull(upperSet, leftmost, rightmost, hull);
     hull.push_back(rightmost);
     quickHull(lowerSet, rightmost, leftmost, hull);
 
+    repairHull(hull);
     return hull;
 }
 
 
+// Remove the segment endpoints and the new hull point from a subset
+template <class T>
+static void dropEndpoints(std::vector<BasicPoint<T>>& s, const BasicPoint<T>& a, const BasicPoint<T>& b, const BasicPoint<T>& p) {
+    s.erase(std::remove_if(s.begin(), s.end(), [&](const BasicPoint<T>& q) {
+        return (q.x == p.x && q.y == p.y) ||
+               (q.x == a.x && q.y == a.y) ||
+               (q.x == b.x && q.y == b.y);
+    }), s.end());
+}
+
 // Recursive function: process subset of points to find and add hull points
-void QuickHullAlgorithm::quickHull(const std::vector<Point>& setAB,
-                                   const Point& a, const Point& b,
-                                   std::vector<Point>& hull) {
+template <class T>
+void BasicQuickHullAlgorithm<T>::quickHull(const std::vector<PointType>& setAB,
+                                           const PointType& a, const PointType& b,
+                                           std::vector<PointType>& hull) {
     if (setAB.empty()) return;
 
     // Find farthest exactly like before, scan the original setAB
-    int   idx = -1;
-    float maxDist = 0.0f;
-    for (int i = 0; i < static_cast<int>(setAB.size()); ++i) {
-        const float c = cross(a, b, setAB[i]);
-        if (c > EPS) {
-            const float d = distanceToLine(a, b, setAB[i]);
-            if (d > maxDist) {
-                maxDist = d;
-                idx = i;
-            }
-        }
-    }
+    const int idx = findFarthest(a, b, setAB);
     if (idx < 0) return;
 
-    const Point p = setAB[idx];
+    const PointType p = setAB[idx];
 
     // Partition using the shared helper on the same base set
-    std::vector<Point> s1 = getPointsOnSide(a, p, setAB, true);
-    std::vector<Point> s2 = getPointsOnSide(p, b, setAB, true);
+    std::vector<PointType> s1 = getPointsOnSide(a, p, setAB, true);
+    std::vector<PointType> s2 = getPointsOnSide(p, b, setAB, true);
 
     // Keep the explicit exclusions, matches the original loop behavior
-    auto dropEndpoints = [&](std::vector<Point>& s) {
-        s.erase(std::remove_if(s.begin(), s.end(), [&](const Point& q) {
-            return (q.x == p.x && q.y == p.y) ||
-                   (q.x == a.x && q.y == a.y) ||
-                   (q.x == b.x && q.y == b.y);
-        }), s.end());
-    };
-    dropEndpoints(s1);
-    dropEndpoints(s2);
+    dropEndpoints(s1, a, b, p);
+    dropEndpoints(s2, a, b, p);
 
     quickHull(s1, a, p, hull);
     hull.push_back(p);
     quickHull(s2, p, b, hull);
 }
+
+// Full hull with O(1) heap allocations: the working buffer and the output
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::runCompleteInPlace(const std::vector<PointType>& points) {
+    Workspace workspace;
+    std::vector<PointType> hull;
+    computeHull(points, hull, workspace);
+    return hull;
+}
+
+// Recursive step of the in-place variant: reorders setAB into [ s1 | s2 | discarded ]
+// and recurses on the two leading sub-spans instead of copying them out. E is a point or
+// an indexed point, pointOf reads its coordinates; the farthest point is picked exactly
+// like findFarthest does.
+template <class E, class PointOf>
+static void quickHullInPlaceImpl(std::span<E> setAB, const E& a, const E& b, std::vector<E>& hull,
+                                 PointOf pointOf) {
+    if (setAB.empty()) return;
+
+    const auto& pa = pointOf(a);
+    const auto& pb = pointOf(b);
+
+    int idx = -1;
+    decltype(Orientation::cross(pa, pb, pa)) maxDist = 0;
+    for (int i = 0; i < static_cast<int>(setAB.size()); ++i) {
+        const auto d = Orientation::cross(pa, pb, pointOf(setAB[i]));
+        if (d > maxDist) {
+            maxDist = d;
+            idx = i;
+        }
+    }
+    if (idx < 0) return;
+
+    // Copy before partitioning moves it around
+    const E p = setAB[idx];
+    const auto& pp = pointOf(p);
+
+    auto isEndpoint = [&](const E& e) {
+        const auto& q = pointOf(e);
+        return q == pp || q == pa || q == pb;
+    };
+
+    const auto s1End = std::partition(setAB.begin(), setAB.end(), [&](const E& q) {
+        return !isEndpoint(q) && Orientation::cross(pa, pp, pointOf(q)) > 0;
+    });
+    const auto s2End = std::partition(s1End, setAB.end(), [&](const E& q) {
+        return !isEndpoint(q) && Orientation::cross(pp, pb, pointOf(q)) > 0;
+    });
+
+    quickHullInPlaceImpl(std::span<E>(setAB.begin(), s1End), a, p, hull, pointOf);
+    hull.push_back(p);
+    quickHullInPlaceImpl(std::span<E>(s1End, s2End), p, b, hull, pointOf);
+}
+
+// Shared body of computeHull and computeHullIndices: work is the caller's copy of the
+// input, partitioned in place, and hull receives the clockwise hull before repairHull
+template <class E, class PointOf>
+static void computeInPlace(std::span<E> work, std::vector<E>& hull, PointOf pointOf) {
+    auto lessXY = [&](const E& a, const E& b) {
+        return pointOf(a) < pointOf(b);
+    };
+
+    const E leftmost  = *std::min_element(work.begin(), work.end(), lessXY);
+    const E rightmost = *std::max_element(work.begin(), work.end(), lessXY);
+    const auto& pl = pointOf(leftmost);
+    const auto& pr = pointOf(rightmost);
+
+    // Layout after partitioning: [ upper set | lower set | points on the line ]
+    const auto upperEnd = std::partition(work.begin(), work.end(), [&](const E& q) {
+        return Orientation::cross(pl, pr, pointOf(q)) > 0;
+    });
+    const auto lowerEnd = std::partition(upperEnd, work.end(), [&](const E& q) {
+        return Orientation::cross(pl, pr, pointOf(q)) < 0;
+    });
+
+    hull.clear();
+    hull.reserve(work.size());
+    hull.push_back(leftmost);
+    quickHullInPlaceImpl(std::span<E>(work.begin(), upperEnd), leftmost, rightmost, hull, pointOf);
+    hull.push_back(rightmost);
+    quickHullInPlaceImpl(std::span<E>(upperEnd, lowerEnd), rightmost, leftmost, hull, pointOf);
+}
+
+template <class T>
+void BasicQuickHullAlgorithm<T>::computeHull(std::span<const PointType> points, std::vector<PointType>& hull,
+                                             Workspace& workspace) {
+    if (points.size() < 3) {
+        hull.assign(points.begin(), points.end());
+        return;
+    }
+
+    std::vector<PointType>& work = workspace.points;
+    work.assign(points.begin(), points.end());
+    computeInPlace(std::span<PointType>(work), hull, [](const PointType& p) -> const PointType& { return p; });
+    repairHull(hull, workspace);
+}
+
+template <class T>
+bool BasicQuickHullAlgorithm<T>::computeHullIndices(std::span<const PointType> points,
+                                                    std::vector<std::uint32_t>& hull, Workspace& workspace) {
+    hull.clear();
+    if (points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    std::vector<IndexedPoint>& work = workspace.indexed;
+    work.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        work[i] = {points[i], static_cast<std::uint32_t>(i)};
+    }
+
+    std::vector<IndexedPoint>& vertices = workspace.hull;
+    if (points.size() < 3) {
+        vertices = work;
+    } else {
+        computeInPlace(std::span<IndexedPoint>(work), vertices,
+                       [](const IndexedPoint& e) -> const PointType& { return e.point; });
+        repairHull(vertices, workspace);
+    }
+    for (const IndexedPoint& e : vertices) {
+        hull.push_back(e.index);
+    }
+    return true;
+}
+
+template <class T>
+void BasicQuickHullAlgorithm<T>::quickHullInPlace(std::span<PointType> setAB,
+                                                  const PointType& a, const PointType& b,
+                                                  std::vector<PointType>& hull) {
+    quickHullInPlaceImpl(setAB, a, b, hull, [](const PointType& p) -> const PointType& { return p; });
+}
+
+// Structure-of-arrays QuickHull. Subsets ping-pong between two buffers of the input size:
+// a subproblem stored at [begin, begin + count) of one buffer writes its two children to
+// the same range of the other buffer, which no pending subproblem still needs. Every
+// subset lies within the extent of the input, so the kernels all share it.
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::runCompleteAlgorithm(const PointSoA& points)
+    requires std::is_same_v<T, float> {
+    const size_t n = points.size();
+    if (n < 3) return points.toPoints();
+
+    size_t minIdx = 0;
+    size_t maxIdx = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (points[i] < points[minIdx]) minIdx = i;
+        if (points[maxIdx] < points[i]) maxIdx = i;
+    }
+    const PointType leftmost  = points[minIdx];
+    const PointType rightmost = points[maxIdx];
+    const OrientationKernels::Extent extent = OrientationKernels::extentOf(points.x(), points.y(), n);
+
+    PointSoA first;
+    PointSoA second;
+    first.resize(n);
+    second.resize(n);
+
+    const size_t upperCount = OrientationKernels::partitionBySide(points.x(), points.y(), n,
+                                                                  leftmost, rightmost, extent,
+                                                                  first.x(), first.y());
+    const size_t lowerCount = OrientationKernels::partitionBySide(points.x(), points.y(), n,
+                                                                  rightmost, leftmost, extent,
+                                                                  first.x() + upperCount, first.y() + upperCount);
+
+    std::vector<PointType> hull;
+    hull.reserve(n);
+    hull.push_back(leftmost);
+    quickHullSoA(first, second, 0, upperCount, leftmost, rightmost, extent, hull);
+    hull.push_back(rightmost);
+    quickHullSoA(first, second, upperCount, lowerCount, rightmost, leftmost, extent, hull);
+
+    repairHull(hull);
+    return hull;
+}
+
+template <class T>
+void BasicQuickHullAlgorithm<T>::quickHullSoA(PointSoA& src, PointSoA& dst, size_t begin, size_t count,
+                                              const PointType& a, const PointType& b,
+                                              const OrientationKernels::Extent& extent, std::vector<PointType>& hull)
+    requires std::is_same_v<T, float> {
+    if (count == 0) return;
+
+    const float* x = src.x() + begin;
+    const float* y = src.y() + begin;
+
+    const OrientationKernels::Farthest farthest = OrientationKernels::argmaxDistance(x, y, count, a, b, extent);
+    if (farthest.index < 0) return;
+
+    const PointType p{x[farthest.index], y[farthest.index]};
+
+    // Endpoints have a cross product of exactly zero, so they never pass the strict side test
+    const size_t n1 = OrientationKernels::partitionBySide(x, y, count, a, p, extent,
+                                                          dst.x() + begin, dst.y() + begin);
+    const size_t n2 = OrientationKernels::partitionBySide(x, y, count, p, b, extent,
+                                                          dst.x() + begin + n1, dst.y() + begin + n1);
+
+    quickHullSoA(dst, src, begin, n1, a, p, extent, hull);
+    hull.push_back(p);
+    quickHullSoA(dst, src, begin + n1, n2, p, b, extent, hull);
+}
+
+// Enable (threadCount > 1) or disable the parallel mode of runCompleteAlgorithm
+template <class T>
+void BasicQuickHullAlgorithm<T>::setThreadCount(unsigned threadCount) {
+    if (threadCount <= 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != threadCount) {
+        m_pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+}
+
+// Number of chunks a linear scan over `size` points is split into
+static size_t chunkCount(size_t size, const WorkStealingPool& pool) {
+    const size_t byCutoff = size / PARALLEL_CUTOFF;
+    const size_t byThreads = static_cast<size_t>(pool.getThreadCount()) * 4;
+    return std::max<size_t>(1, std::min(byCutoff, byThreads));
+}
+
+// Same result as getPointsOnSide: chunks are filtered concurrently and concatenated in input order
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::getPointsOnSideParallel(const PointType& a, const PointType& b,
+                                                                               const std::vector<PointType>& points, bool left,
+                                                                               WorkStealingPool& pool) {
+    const size_t chunks = chunkCount(points.size(), pool);
+    if (chunks == 1) return getPointsOnSide(a, b, points, left);
+
+    std::vector<std::vector<PointType>> parts(chunks);
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        for (size_t c = 0; c < chunks; ++c) {
+            group.run([&, c] {
+                const size_t begin = points.size() * c / chunks;
+                const size_t end = points.size() * (c + 1) / chunks;
+                for (size_t i = begin; i < end; ++i) {
+                    const Cross d = cross(a, b, points[i]);
+                    if ((left && d > 0) || (!left && d < 0)) {
+                        parts[c].push_back(points[i]);
+                    }
+                }
+            });
+        }
+        group.wait();
+    }
+
+    size_t total = 0;
+    for (const auto& part : parts) total += part.size();
+
+    std::vector<PointType> result;
+    result.reserve(total);
+    for (const auto& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+// Index of the farthest point strictly left of AB, -1 if there is none.
+// Ties resolve to the lowest index, exactly like the serial scan.
+template <class T>
+int BasicQuickHullAlgorithm<T>::findFarthestParallel(const PointType& a, const PointType& b,
+                                                     const std::vector<PointType>& points, WorkStealingPool& pool) {
+    const size_t chunks = chunkCount(points.size(), pool);
+
+    std::vector<int> bestIndex(chunks, -1);
+    std::vector<Cross> bestDist(chunks, 0);
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        for (size_t c = 0; c < chunks; ++c) {
+            group.run([&, c] {
+                const size_t begin = points.size() * c / chunks;
+                const size_t end = points.size() * (c + 1) / chunks;
+                for (size_t i = begin; i < end; ++i) {
+                    if (cross(a, b, points[i]) > 0) {
+                        const Cross d = distanceToLine(a, b, points[i]);
+                        if (d > bestDist[c]) {
+                            bestDist[c] = d;
+                            bestIndex[c] = static_cast<int>(i);
+                        }
+                    }
+                }
+            });
+        }
+        group.wait();
+    }
+
+    int idx = -1;
+    Cross maxDist = 0;
+    for (size_t c = 0; c < chunks; ++c) {
+        if (bestIndex[c] >= 0 && bestDist[c] > maxDist) {
+            maxDist = bestDist[c];
+            idx = bestIndex[c];
+        }
+    }
+    return idx;
+}
+
+// Parallel version of quickHull. Both halves are computed into their own buffers
+// and appended in order, so the hull comes out identical to the serial one.
+template <class T>
+void BasicQuickHullAlgorithm<T>::quickHullParallel(const std::vector<PointType>& setAB,
+                                                   const PointType& a, const PointType& b,
+                                                   std::vector<PointType>& hull,
+                                                   WorkStealingPool& pool) {
+    if (setAB.size() < PARALLEL_CUTOFF) {
+        quickHull(setAB, a, b, hull);
+        return;
+    }
+
+    const int idx = findFarthestParallel(a, b, setAB, pool);
+    if (idx < 0) return;
+
+    const PointType p = setAB[idx];
+
+    std::vector<PointType> s1;
+    std::vector<PointType> s2;
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        group.run([&] {
+            s1 = getPointsOnSideParallel(a, p, setAB, true, pool);
+            dropEndpoints(s1, a, b, p);
+        });
+        s2 = getPointsOnSideParallel(p, b, setAB, true, pool);
+        dropEndpoints(s2, a, b, p);
+        group.wait();
+    }
+
+    std::vector<PointType> leftHull;
+    std::vector<PointType> rightHull;
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        group.run([&] { quickHullParallel(s1, a, p, leftHull, pool); });
+        quickHullParallel(s2, p, b, rightHull, pool);
+        group.wait();
+    }
+
+    hull.insert(hull.end(), leftHull.begin(), leftHull.end());
+    hull.push_back(p);
+    hull.insert(hull.end(), rightHull.begin(), rightHull.end());
+}
+
+// runCompleteAlgorithm on the thread pool: upper and lower chains run as separate tasks
+template <class T>
+std::vector<BasicPoint<T>> BasicQuickHullAlgorithm<T>::runParallel(const std::vector<PointType>& points) {
+    WorkStealingPool& pool = *m_pool;
+
+    auto lessXY = [](const PointType& a, const PointType& b) {
+        if (a.x != b.x) return a.x < b.x;
+        return a.y < b.y;
+    };
+
+    const auto [minIt, maxIt] = std::minmax_element(points.begin(), points.end(), lessXY);
+    const PointType leftmost  = *minIt;
+    const PointType rightmost = *maxIt;
+
+    std::vector<PointType> upperSet;
+    std::vector<PointType> lowerSet;
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        group.run([&] { upperSet = getPointsOnSideParallel(leftmost, rightmost, points, true, pool); });
+        lowerSet = getPointsOnSideParallel(leftmost, rightmost, points, false, pool);
+        group.wait();
+    }
+
+    std::vector<PointType> upperHull;
+    std::vector<PointType> lowerHull;
+    {
+        WorkStealingPool::TaskGroup group(pool);
+        group.run([&] { quickHullParallel(upperSet, leftmost, rightmost, upperHull, pool); });
+        quickHullParallel(lowerSet, rightmost, leftmost, lowerHull, pool);
+        group.wait();
+    }
+
+    std::vector<PointType> hull;
+    hull.reserve(upperHull.size() + lowerHull.size() + 2);
+    hull.push_back(leftmost);
+    hull.insert(hull.end(), upperHull.begin(), upperHull.end());
+    hull.push_back(rightmost);
+    hull.insert(hull.end(), lowerHull.begin(), lowerHull.end());
+    repairHull(hull);
+    return hull;
+}
+
+template class BasicQuickHullAlgorithm<float>;
+template class BasicQuickHullAlgorithm<double>;
+#ifdef __SIZEOF_INT128__
+template class BasicQuickHullAlgorithm<std::int32_t>;
+template class BasicQuickHullAlgorithm<std::int64_t>;
+#endif
@@ -1,63 +1,160 @@
 #ifndef QUICKHULLALGORITHM_H
 #define QUICKHULLALGORITHM_H
 
+#include "AndrewAlgorithm.h"
 #include "IAlgorithm.h"
+#include "Orientation.h"
+#include "OrientationKernels.h"
+#include "WorkStealingPool.h"
+#include "point_providers/PointSoA.h"
+#include <cstdint>
 #include <vector>
-#include <deque>
-#include <set>
+#include <memory>
+#include <span>
+#include <type_traits>
 
-class QuickHullAlgorithm : public IAlgorithm {
+// QuickHull over points with coordinates of type T; like BasicAndrewAlgorithm, the members
+// are instantiated in the .cpp. The structure-of-arrays path only exists for float.
+template <class T>
+class BasicQuickHullAlgorithm : public BasicIAlgorithm<T> {
 public:
-    explicit QuickHullAlgorithm(const std::vector<Point>& points);
+    using PointType = BasicPoint<T>;
+    using IndexedPoint = BasicIndexedPoint<T>;
+    using Cross = CrossType<T>;
+
+    explicit BasicQuickHullAlgorithm(const std::vector<PointType>& points);
 
     bool step() override;
-    std::vector<Point> getCurrentHull() override;
-    void reset(const std::vector<Point>& points) override;
+    std::vector<PointType> getCurrentHull() override;
+    void reset(const std::vector<PointType>& points) override;
     bool isFinished() const override;
-    std::vector<Point> runCompleteAlgorithm(const std::vector<Point>& points) override;
+    std::vector<PointType> runCompleteAlgorithm(const std::vector<PointType>& points) override;
+    // Structure-of-arrays input, scanned and partitioned with the vectorized OrientationKernels
+    std::vector<PointType> runCompleteAlgorithm(const PointSoA& points) requires std::is_same_v<T, float>;
+    // Reads the input in place (e.g. a memory-mapped file); only the side subsets are copied
+    std::vector<PointType> runCompleteAlgorithm(std::span<const PointType> points);
+
+    // Step mode role of a point: HULL once it was added to the hull, ACTIVE while it is
+    // in the subset of a task, INACTIVE once it is known not to be a vertex
+    enum class PointState : std::uint8_t { INACTIVE, ACTIVE, HULL };
 
     // Visualization methods
-    std::vector<std::pair<Point, Point>> getActiveSegments() const;
-    std::vector<Point> getCandidatePoints() const;
-    std::vector<Point> getFarthestPoints() const;
-    std::set<Point> getActivePoints() const;
-    bool hasActiveSegments() const { return !m_currentLevelTasks.empty(); }
+    std::vector<std::pair<PointType, PointType>> getActiveSegments() const;
+    std::vector<PointType> getCandidatePoints() const;
+    std::vector<PointType> getFarthestPoints() const;
+    // Indexed like the points passed to reset(); updated only for the points a step touches
+    const std::vector<PointState>& getPointStates() const { return m_pointStates; }
+    bool hasActiveSegments() const { return m_inPreviewPhase && !m_tasks.empty(); }
     bool isInPreviewPhase() const { return m_inPreviewPhase; }
 
-    static void quickHull(const std::vector<Point>& points,
-                          const Point& a, const Point& b,
-                          std::vector<Point>& hull);
+    // Parallel mode for runCompleteAlgorithm; 1 (the default) keeps the serial recursion
+    void setThreadCount(unsigned threadCount);
+    unsigned getThreadCount() const { return m_pool ? m_pool->getThreadCount() : 1; }
+
+    // Scan kernels of the recursion, public for the micro benchmarks
+    static int findFarthest(const PointType& a, const PointType& b, std::span<const PointType> points);
+    static std::vector<PointType> getPointsOnSide(const PointType& a, const PointType& b, std::span<const PointType> points, bool left);
+
+    static void quickHull(const std::vector<PointType>& points,
+                          const PointType& a, const PointType& b,
+                          std::vector<PointType>& hull);
+
+    // Allocation-light variant: one working copy of the input is partitioned in place
+    // and every recursion level works on a sub-span of it
+    static std::vector<PointType> runCompleteInPlace(const std::vector<PointType>& points);
+
+    // Scratch storage of computeHull and computeHullIndices, kept by the caller between calls.
+    // The last two hold repairHull's rebuild of a non-convex result.
+    struct Workspace {
+        std::vector<PointType> points;
+        std::vector<IndexedPoint> indexed;
+        std::vector<IndexedPoint> hull;
+        typename BasicAndrewAlgorithm<T>::Workspace andrew;
+        std::vector<std::uint32_t> rebuilt;
+    };
+
+    // The in-place variant with the working copy in a reusable workspace and the result in
+    // a caller-owned buffer: once both have grown to the input size, a call does no heap
+    // allocation, the rebuild of repairHull included
+    static void computeHull(std::span<const PointType> points, std::vector<PointType>& hull,
+                            Workspace& workspace);
+    // Index mode: hull[k] is the position in points of the k-th vertex of computeHull's
+    // result. The partitions move compact (point, index) pairs, never the caller's records.
+    // Returns false, with hull empty, for inputs too large for 32-bit indices.
+    static bool computeHullIndices(std::span<const PointType> points, std::vector<std::uint32_t>& hull,
+                                   Workspace& workspace);
+    static void quickHullInPlace(std::span<PointType> points,
+                                 const PointType& a, const PointType& b,
+                                 std::vector<PointType>& hull);
+
+    // Same recursion as quickHull, subproblems above the size cutoff run as pool tasks
+    static void quickHullParallel(const std::vector<PointType>& points,
+                                  const PointType& a, const PointType& b,
+                                  std::vector<PointType>& hull,
+                                  WorkStealingPool& pool);
 
 private:
     enum class Phase { PREVIEW, COMMIT };
 
+    // The points strictly left of ab are m_stepPoints[begin, end); farthest is the
+    // position of the farthest one, found by the preview. edge is the hull node of a,
+    // whose successor is b: the farthest point is linked in after it.
     struct Task {
-        Point a;
-        Point b;
-        std::vector<Point> set;
-        int insertPos;
+        PointType a;
+        PointType b;
+        size_t begin;
+        size_t end;
+        size_t farthest;
+        size_t edge;
+    };
+
+    // Step mode hull: a circular list linked through indices, starting at the leftmost
+    // point (node 0). Nodes are only appended, so the node of an edge stays valid.
+    struct HullNode {
+        PointType point;
+        size_t next;
     };
 
-    std::vector<Point> m_points;
-    std::vector<Point> m_hull;
-    std::deque<Task> m_tasks;
-    std::deque<Task> m_currentLevelTasks;
+    std::vector<PointType> m_points;
+    // The finished hull; while stepping, getCurrentHull reads it from m_hullNodes
+    std::vector<PointType> m_hull;
+    std::vector<HullNode> m_hullNodes;
+    // Tasks of the current recursion level, in hull order
+    std::vector<Task> m_tasks;
     bool m_finished;
     Phase m_phase;
     bool m_inPreviewPhase;
 
+    // Step mode working set: the points of all tasks, each task's subset a contiguous
+    // range that a commit partitions in place into the ranges of its two subtasks
+    std::vector<IndexedPoint> m_stepPoints;
+    std::vector<IndexedPoint> m_stepScratch;
+
     // Visualization state
-    std::vector<Point> m_currentFarthestPoints;
-    std::set<Point> m_activePoints;
-    std::deque<Task> m_pendingTasks; // Tasks waiting to be committed
+    std::vector<PointType> m_currentFarthestPoints;
+    std::vector<PointState> m_pointStates;
+
+    std::unique_ptr<WorkStealingPool> m_pool;
 
-    static float cross(const Point& o, const Point& a, const Point& b);
-    static float distanceToLine(const Point& a, const Point& b, const Point& p);
+    static Cross cross(const PointType& o, const PointType& a, const PointType& b);
+    static Cross distanceToLine(const PointType& a, const PointType& b, const PointType& p);
+    static void repairHull(std::vector<PointType>& hull);
+    static void repairHull(std::vector<PointType>& hull, Workspace& workspace);
+    static void repairHull(std::vector<IndexedPoint>& hull, Workspace& workspace);
     void initialize();
-    static std::vector<Point> getPointsOnSide(const Point& a, const Point& b, const std::vector<Point>& points, bool left);
-    void updateActivePoints();
+    static void quickHullSoA(PointSoA& src, PointSoA& dst, size_t begin, size_t count,
+                             const PointType& a, const PointType& b, const OrientationKernels::Extent& extent,
+                             std::vector<PointType>& hull) requires std::is_same_v<T, float>;
+    static std::vector<PointType> getPointsOnSideParallel(const PointType& a, const PointType& b, const std::vector<PointType>& points,
+                                                          bool left, WorkStealingPool& pool);
+    static int findFarthestParallel(const PointType& a, const PointType& b, const std::vector<PointType>& points,
+                                    WorkStealingPool& pool);
+    std::vector<PointType> runParallel(const std::vector<PointType>& points);
     void computePreview();
     void commitPreview();
+    std::vector<PointType> materializeHull() const;
 };
 
-#endif //QUICKHULLALGORITHM_H
\ No newline at end of file
+using QuickHullAlgorithm = BasicQuickHullAlgorithm<float>;
+
+#endif //QUICKHULLALGORITHM_H
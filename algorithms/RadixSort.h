@@ -0,0 +1,108 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "WorkStealingPool.h"
+#include "point_providers/Point.h"
+
+// Order-preserving unsigned image of a coordinate: the keys compare as unsigned integers
+// exactly like the coordinates compare with <. Negative floats have all bits inverted and
+// the others get the sign bit set; -0 is mapped like +0, so equal coordinates get equal keys.
+inline std::uint32_t radixKey(float v) {
+    const auto bits = std::bit_cast<std::uint32_t>(v == 0.0f ? 0.0f : v);
+    return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
+inline std::uint64_t radixKey(double v) {
+    const auto bits = std::bit_cast<std::uint64_t>(v == 0.0 ? 0.0 : v);
+    return (bits & 0x8000000000000000u) ? ~bits : bits | 0x8000000000000000u;
+}
+
+inline std::uint32_t radixKey(std::int32_t v) {
+    return static_cast<std::uint32_t>(v) ^ 0x80000000u;
+}
+
+inline std::uint64_t radixKey(std::int64_t v) {
+    return static_cast<std::uint64_t>(v) ^ 0x8000000000000000u;
+}
+
+// LSD radix sort of points by (x, y), the order of operator<, one byte per pass: all bytes
+// of the y key first, then those of the x key, every pass stable. The histograms of all
+// passes come from a single read of the input, split into chunks on the pool if one is
+// given; passes where every point has the same byte are skipped. scratch is resized to the
+// input size and may be kept by the caller to avoid the allocation on the next call.
+template <class T>
+void radixSortPoints(std::vector<BasicPoint<T>>& points, std::vector<BasicPoint<T>>& scratch,
+                     WorkStealingPool* pool = nullptr, std::size_t minChunk = std::size_t{1} << 16) {
+    using Key = decltype(radixKey(T{}));
+    constexpr std::size_t KEY_BYTES = sizeof(Key);
+    constexpr std::size_t PASSES = 2 * KEY_BYTES;
+    using Histogram = std::array<std::array<std::size_t, 256>, PASSES>;
+
+    const std::size_t n = points.size();
+    if (n < 2) return;
+
+    auto count = [&points](Histogram& h, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const Key y = radixKey(points[i].y);
+            const Key x = radixKey(points[i].x);
+            for (std::size_t b = 0; b < KEY_BYTES; ++b) {
+                ++h[b][(y >> (8 * b)) & 0xff];
+                ++h[KEY_BYTES + b][(x >> (8 * b)) & 0xff];
+            }
+        }
+    };
+
+    const std::size_t chunks = pool ? std::max<std::size_t>(1, std::min<std::size_t>(pool->getThreadCount(), n / minChunk))
+                                    : 1;
+    std::vector<Histogram> partial(chunks, Histogram{});
+    if (chunks == 1) {
+        count(partial[0], 0, n);
+    } else {
+        WorkStealingPool::TaskGroup group(*pool);
+        for (std::size_t c = 0; c < chunks; ++c) {
+            group.run([&, c] { count(partial[c], n * c / chunks, n * (c + 1) / chunks); });
+        }
+        group.wait();
+    }
+    for (std::size_t c = 1; c < chunks; ++c) {
+        for (std::size_t p = 0; p < PASSES; ++p) {
+            for (std::size_t d = 0; d < 256; ++d) partial[0][p][d] += partial[c][p][d];
+        }
+    }
+    const Histogram& histogram = partial[0];
+
+    scratch.resize(n);
+    std::vector<BasicPoint<T>>* src = &points;
+    std::vector<BasicPoint<T>>* dst = &scratch;
+    std::array<std::size_t, 256> offsets;
+
+    for (std::size_t p = 0; p < PASSES; ++p) {
+        const std::size_t shift = 8 * (p % KEY_BYTES);
+        const bool useX = p >= KEY_BYTES;
+        const BasicPoint<T>& first = (*src)[0];
+        if (histogram[p][(radixKey(useX ? first.x : first.y) >> shift) & 0xff] == n) continue;
+
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d < 256; ++d) {
+            offsets[d] = sum;
+            sum += histogram[p][d];
+        }
+        for (const BasicPoint<T>& q : *src) {
+            const Key key = radixKey(useX ? q.x : q.y);
+            (*dst)[offsets[(key >> shift) & 0xff]++] = q;
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != &points) {
+        points.swap(scratch);
+    }
+}
+
+#endif //RADIXSORT_H
@@ -0,0 +1,205 @@
+#include "SlidingWindowHull.h"
+#include "AndrewAlgorithm.h"
+#include <algorithm>
+#include <cmath>
+
+// Blocks of about sqrt(N) points balance the flip cost against the suffix precomputation
+static size_t defaultBlockSize(SlidingWindowHull::Window window, double length) {
+    if (window == SlidingWindowHull::Window::TIME) {
+        return 256;
+    }
+    const auto root = static_cast<size_t>(std::sqrt(std::max(length, 1.0)));
+    return std::clamp<size_t>(root, 16, 4096);
+}
+
+static std::vector<Point> mergeHulls(const std::vector<Point>& a, const std::vector<Point>& b) {
+    std::vector<Point> points;
+    points.reserve(a.size() + b.size());
+    points.insert(points.end(), a.begin(), a.end());
+    points.insert(points.end(), b.begin(), b.end());
+
+    AndrewAlgorithm andrew({});
+    return points.empty() ? points : andrew.runCompleteAlgorithm(points);
+}
+
+SlidingWindowHull::SlidingWindowHull(Window window, double length, size_t blockSize)
+    : m_window(window), m_length(length),
+      m_blockSize(blockSize ? blockSize : defaultBlockSize(window, length)) {}
+
+void SlidingWindowHull::push(const Point& p, double timestamp) {
+    m_now = std::max(m_now, timestamp);
+
+    if (m_back.empty() || m_back.back().closed) {
+        m_back.emplace_back();
+        m_back.back().points.reserve(m_blockSize);
+    }
+
+    Block& open = m_back.back();
+    open.points.push_back(p);
+    open.times.push_back(m_now);
+    open.incremental.addPoint(p);
+    m_backHull.addPoint(p);
+    m_size++;
+
+    if (open.points.size() == m_blockSize) {
+        open.hull = open.incremental.hull();
+        open.incremental.clear();
+        open.closed = true;
+
+        // A window smaller than a block already expires points of the open block;
+        // such a block has to move to the front right away
+        if (open.expired > 0) {
+            flip();
+        }
+    }
+
+    m_dirty = true;
+    expire();
+}
+
+void SlidingWindowHull::advanceTo(double timestamp) {
+    m_now = std::max(m_now, timestamp);
+    expire();
+}
+
+void SlidingWindowHull::expire() {
+    while (m_size > 0) {
+        if (m_window == Window::COUNT) {
+            if (static_cast<double>(m_size) <= m_length) break;
+        } else {
+            const Block& oldest = m_front.empty() ? m_back.front() : m_front.front();
+            if (oldest.times[oldest.expired] > m_now - m_length) break;
+        }
+        expireOldest();
+    }
+}
+
+void SlidingWindowHull::expireOldest() {
+    if (m_front.empty()) {
+        flip();
+    }
+
+    m_size--;
+    m_dirty = true;
+
+    if (m_front.empty()) {
+        // Only the open block is left; its expired points stay in m_backHull,
+        // so queries read its survivors directly until it is full
+        Block& open = m_back.front();
+        if (++open.expired == open.points.size()) {
+            m_back.clear();
+            m_backHull.clear();
+        }
+        return;
+    }
+
+    // Suffix hulls are built once, when the first point of a full block leaves the window
+    Block& oldest = m_front.front();
+    if (oldest.expired == 0) {
+        buildSuffixHulls(oldest);
+    }
+    if (++oldest.expired == oldest.points.size()) {
+        m_front.pop_front();
+    }
+}
+
+// Moves all full back blocks to the front and computes their aggregates from the newest
+// to the oldest; the back hull restarts with the points of the open block
+void SlidingWindowHull::flip() {
+    const bool hasOpen = !m_back.empty() && !m_back.back().closed;
+    const size_t closedCount = m_back.size() - (hasOpen ? 1 : 0);
+    if (closedCount == 0) return;
+
+    const size_t first = m_front.size();
+    for (size_t i = 0; i < closedCount; i++) {
+        m_front.push_back(std::move(m_back.front()));
+        m_back.pop_front();
+    }
+
+    for (size_t i = m_front.size(); i-- > first;) {
+        Block& block = m_front[i];
+        if (block.expired > 0 && block.suffixOffsets.empty()) {
+            buildSuffixHulls(block);
+        }
+        block.aggregate = i + 1 < m_front.size() ? mergeHulls(block.hull, m_front[i + 1].aggregate) : block.hull;
+    }
+
+    m_backHull.clear();
+    if (hasOpen) {
+        m_backHull.addPoints(m_back.front().points);
+    }
+}
+
+// Adds the points from the newest to the oldest one; after adding point i the
+// incremental hull is the hull of points[i..]
+void SlidingWindowHull::buildSuffixHulls(Block& block) {
+    const size_t n = block.points.size();
+    std::vector<std::vector<Point>> hulls(n);
+
+    IncrementalHull suffix;
+    for (size_t i = n; i-- > 0;) {
+        suffix.addPoint(block.points[i]);
+        hulls[i] = suffix.hull();
+    }
+
+    block.suffixOffsets.assign(n + 1, 0);
+    block.suffixVertices.clear();
+    for (size_t i = 0; i < n; i++) {
+        block.suffixOffsets[i] = block.suffixVertices.size();
+        block.suffixVertices.insert(block.suffixVertices.end(), hulls[i].begin(), hulls[i].end());
+    }
+    block.suffixOffsets[n] = block.suffixVertices.size();
+}
+
+// Hull of the points of a full block that are still in the window
+std::vector<Point> SlidingWindowHull::suffixHull(const Block& block) {
+    if (block.expired == 0) return block.hull;
+    const auto begin = block.suffixVertices.begin();
+    return {begin + static_cast<std::ptrdiff_t>(block.suffixOffsets[block.expired]),
+            begin + static_cast<std::ptrdiff_t>(block.suffixOffsets[block.expired + 1])};
+}
+
+const std::vector<Point>& SlidingWindowHull::hull() {
+    if (!m_dirty) {
+        return m_hull;
+    }
+
+    m_candidates.clear();
+    auto append = [this](const std::vector<Point>& points) {
+        m_candidates.insert(m_candidates.end(), points.begin(), points.end());
+    };
+
+    if (!m_front.empty()) {
+        const Block& oldest = m_front.front();
+        if (oldest.expired == 0) {
+            append(oldest.aggregate);
+        } else {
+            append(suffixHull(oldest));
+            if (m_front.size() > 1) append(m_front[1].aggregate);
+        }
+    }
+
+    if (m_front.empty() && !m_back.empty() && m_back.front().expired > 0) {
+        // The open block is the oldest one and partly expired
+        const Block& open = m_back.front();
+        m_candidates.insert(m_candidates.end(), open.points.begin() + static_cast<std::ptrdiff_t>(open.expired),
+                            open.points.end());
+    } else {
+        append(m_backHull.hull());
+    }
+
+    AndrewAlgorithm andrew({});
+    m_hull = m_candidates.empty() ? std::vector<Point>{} : andrew.runCompleteAlgorithm(m_candidates);
+    m_dirty = false;
+    return m_hull;
+}
+
+void SlidingWindowHull::clear() {
+    m_front.clear();
+    m_back.clear();
+    m_backHull.clear();
+    m_size = 0;
+    m_now = 0.0;
+    m_hull.clear();
+    m_dirty = true;
+}
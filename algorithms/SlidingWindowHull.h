@@ -0,0 +1,71 @@
+#ifndef SLIDINGWINDOWHULL_H
+#define SLIDINGWINDOWHULL_H
+
+#include <deque>
+#include <vector>
+#include "IncrementalHull.h"
+#include "point_providers/Point.h"
+
+// Convex hull of the last N points, or of the points of the last T seconds, of a
+// time-ordered stream. The window is split into blocks of B points that are kept in a
+// two-stack queue:
+//  - back: the newest blocks, whose points all go into one insert-only IncrementalHull,
+//  - front: older blocks, each with the hull of itself and all newer front blocks,
+//    computed when the front runs empty and the back blocks are moved over,
+//  - the oldest block, once it starts to expire, gets the hulls of all its suffixes.
+// A query merges at most three hulls, so it costs O(h log h) independent of N.
+// Pushes cost O(log h) amortized plus O(h) per point for the suffix hulls.
+class SlidingWindowHull {
+public:
+    enum class Window { COUNT, TIME };
+
+    // COUNT: length is the number of points; TIME: length is the duration in the
+    // unit of the timestamps. blockSize 0 picks one from the window length.
+    SlidingWindowHull(Window window, double length, size_t blockSize = 0);
+
+    // Timestamps must not decrease; smaller ones are treated as the latest timestamp
+    void push(const Point& p, double timestamp = 0.0);
+    // Expires points of a TIME window without adding one
+    void advanceTo(double timestamp);
+
+    // Hull of the points in the window, same layout as AndrewAlgorithm's result
+    const std::vector<Point>& hull();
+
+    size_t size() const { return m_size; }
+    size_t getBlockSize() const { return m_blockSize; }
+    void clear();
+
+private:
+    struct Block {
+        std::vector<Point> points;
+        std::vector<double> times;
+        IncrementalHull incremental;        // hull of points, while the block is open
+        std::vector<Point> hull;            // hull of points, once the block is full
+        std::vector<Point> aggregate;       // front only: hull of this and all newer front blocks
+        size_t expired = 0;                 // points already out of the window
+        std::vector<Point> suffixVertices;  // hulls of points[i..] for every i, concatenated
+        std::vector<size_t> suffixOffsets;
+        bool closed = false;
+    };
+
+    Window m_window;
+    double m_length;
+    size_t m_blockSize;
+    std::deque<Block> m_front;
+    std::deque<Block> m_back;   // the last one may be open
+    IncrementalHull m_backHull; // all points of m_back
+    size_t m_size = 0;
+    double m_now = 0.0;
+
+    std::vector<Point> m_hull;
+    std::vector<Point> m_candidates;
+    bool m_dirty = true;
+
+    void expire();
+    void expireOldest();
+    void flip();
+    static void buildSuffixHulls(Block& block);
+    static std::vector<Point> suffixHull(const Block& block);
+};
+
+#endif //SLIDINGWINDOWHULL_H
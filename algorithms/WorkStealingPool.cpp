@@ -0,0 +1,125 @@
+#include "WorkStealingPool.h"
+
+namespace {
+    // Identifies the pool and deque of the current thread (null for external threads)
+    thread_local const WorkStealingPool* t_pool = nullptr;
+    thread_local std::size_t t_queue = 0;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount) {
+    if (threadCount == 0) threadCount = 1;
+
+    for (unsigned i = 0; i < threadCount; ++i) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 1; i < threadCount; ++i) {
+        m_workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard lock(m_sleepMutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::size_t WorkStealingPool::currentQueue() const {
+    return t_pool == this ? t_queue : 0;
+}
+
+void WorkStealingPool::push(std::function<void()> task) {
+    Queue& queue = *m_queues[currentQueue()];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        // Incremented under the sleep mutex so a worker about to sleep cannot miss it
+        std::lock_guard lock(m_sleepMutex);
+        ++m_queued;
+    }
+    m_wake.notify_one();
+}
+
+// Pop from the own deque (newest first), otherwise steal the oldest task of another deque
+bool WorkStealingPool::runOne() {
+    const std::size_t self = currentQueue();
+    const std::size_t count = m_queues.size();
+
+    std::function<void()> task;
+    for (std::size_t k = 0; k < count && !task; ++k) {
+        Queue& queue = *m_queues[(self + k) % count];
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        if (k == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+    --m_queued;
+    task();
+    return true;
+}
+
+void WorkStealingPool::workerLoop(std::size_t self) {
+    t_pool = this;
+    t_queue = self;
+
+    while (true) {
+        if (runOne()) continue;
+
+        std::unique_lock lock(m_sleepMutex);
+        m_wake.wait(lock, [this] { return m_stop || m_queued.load() > 0; });
+        if (m_stop) return;
+    }
+}
+
+WorkStealingPool::TaskGroup::~TaskGroup() {
+    // Never leave tasks behind that reference this group; errors are dropped here
+    while (m_pending.load() > 0) {
+        if (!m_pool.runOne()) std::this_thread::yield();
+    }
+}
+
+void WorkStealingPool::TaskGroup::run(std::function<void()> task) {
+    if (m_pool.m_workers.empty()) {
+        // Single-threaded pool: nothing could steal the task, run it right away
+        task();
+        return;
+    }
+
+    ++m_pending;
+    m_pool.push([this, task = std::move(task)] {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard lock(m_errorMutex);
+            if (!m_error) m_error = std::current_exception();
+        }
+        --m_pending;
+    });
+}
+
+void WorkStealingPool::TaskGroup::wait() {
+    while (m_pending.load() > 0) {
+        if (!m_pool.runOne()) std::this_thread::yield();
+    }
+
+    std::lock_guard lock(m_errorMutex);
+    if (m_error) {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fork/join thread pool. Every thread owns a deque: it pushes and pops its own
+// tasks at the back and steals from the front of the other deques when idle.
+// The thread that waits on a TaskGroup keeps executing tasks instead of blocking,
+// so nested fork/join (recursive divide and conquer) cannot deadlock.
+class WorkStealingPool {
+public:
+    // Tracks the tasks forked in one scope; wait() joins them.
+    class TaskGroup {
+    public:
+        explicit TaskGroup(WorkStealingPool& pool) : m_pool(pool) {}
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        ~TaskGroup();
+
+        void run(std::function<void()> task);
+        void wait();
+
+    private:
+        WorkStealingPool& m_pool;
+        std::atomic<int> m_pending{0};
+        std::mutex m_errorMutex;
+        std::exception_ptr m_error;
+    };
+
+    // threadCount includes the calling thread, so 1 means "no worker threads".
+    explicit WorkStealingPool(unsigned threadCount = std::thread::hardware_concurrency());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    unsigned getThreadCount() const { return static_cast<unsigned>(m_queues.size()); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues; // slot 0 belongs to external callers
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<int> m_queued{0};
+    bool m_stop = false;
+
+    void push(std::function<void()> task);
+    bool runOne();
+    void workerLoop(std::size_t self);
+    std::size_t currentQueue() const;
+};
+
+#endif //WORKSTEALINGPOOL_H
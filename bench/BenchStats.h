@@ -0,0 +1,51 @@
+#ifndef BENCHSTATS_H
+#define BENCHSTATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Summary of repeated timing samples (nanoseconds)
+struct BenchStats {
+    size_t runs = 0;
+    double min = 0;
+    double max = 0;
+    double mean = 0;
+    double median = 0;
+    double p95 = 0;
+    double stddev = 0;  // sample standard deviation
+
+    static BenchStats fromSamples(std::vector<double> samples) {
+        BenchStats s;
+        s.runs = samples.size();
+        if (samples.empty()) return s;
+
+        std::sort(samples.begin(), samples.end());
+        s.min = samples.front();
+        s.max = samples.back();
+        s.median = percentile(samples, 0.5);
+        s.p95 = percentile(samples, 0.95);
+
+        double sum = 0;
+        for (double v : samples) sum += v;
+        s.mean = sum / static_cast<double>(samples.size());
+
+        if (samples.size() > 1) {
+            double sq = 0;
+            for (double v : samples) sq += (v - s.mean) * (v - s.mean);
+            s.stddev = std::sqrt(sq / static_cast<double>(samples.size() - 1));
+        }
+        return s;
+    }
+
+    // Linear interpolation between closest ranks, sorted input
+    static double percentile(const std::vector<double>& sorted, double q) {
+        if (sorted.empty()) return 0;
+        const double rank = q * static_cast<double>(sorted.size() - 1);
+        const size_t lo = static_cast<size_t>(std::floor(rank));
+        const size_t hi = std::min(lo + 1, sorted.size() - 1);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - static_cast<double>(lo));
+    }
+};
+
+#endif //BENCHSTATS_H
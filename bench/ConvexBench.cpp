@@ -0,0 +1,244 @@
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchStats.h"
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/ChanAlgorithm.h"
+#include "algorithms/FilteredAlgorithm.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/LinePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+// Headless benchmark over every provider x size x algorithm.
+// Only runCompleteAlgorithm is timed: point generation and algorithm construction
+// happen outside the measured region, and every configuration gets warmup runs.
+
+struct Options {
+    std::vector<std::string> providers = {"random", "square", "line", "circle"};
+    std::vector<std::string> algorithms = {"andrew", "quickhull", "chan"};
+    std::vector<int> sizes = {1000, 10000, 100000, 1000000};
+    int warmup = 2;
+    int runs = 10;
+    unsigned threads = 1;
+    unsigned seed = 42;
+    bool prefilter = false;
+    std::string format = "table";
+    std::string out;
+};
+
+struct Result {
+    std::string provider;
+    std::string algorithm;
+    int requested;
+    size_t points;
+    size_t hullSize;
+    BenchStats stats;
+};
+
+static std::vector<std::string> splitList(const std::string& s) {
+    std::vector<std::string> parts;
+    std::stringstream ss(s);
+    std::string part;
+    while (std::getline(ss, part, ',')) {
+        if (!part.empty()) parts.push_back(part);
+    }
+    return parts;
+}
+
+static void printUsage(const char* name) {
+    std::cerr << "Usage: " << name << " [options]\n"
+              << "  --providers random,square,line,circle\n"
+              << "  --algorithms andrew,quickhull,chan\n"
+              << "  --sizes 1000,10000,100000,1000000\n"
+              << "  --warmup N        untimed runs per configuration (default 2)\n"
+              << "  --runs N          timed runs per configuration (default 10)\n"
+              << "  --threads N       thread count for the parallel modes (default 1)\n"
+              << "  --seed N          seed of the random provider (default 42)\n"
+              << "  --prefilter       wrap every algorithm in the Akl-Toussaint filter\n"
+              << "  --format table|csv|json\n"
+              << "  --out FILE        write the results to FILE instead of stdout\n";
+}
+
+static bool parseOptions(int argc, char** argv, Options& o) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) throw std::invalid_argument("missing value for " + arg);
+            return argv[++i];
+        };
+
+        if (arg == "--providers") o.providers = splitList(value());
+        else if (arg == "--algorithms") o.algorithms = splitList(value());
+        else if (arg == "--sizes") {
+            o.sizes.clear();
+            for (const auto& s : splitList(value())) o.sizes.push_back(std::stoi(s));
+        }
+        else if (arg == "--warmup") o.warmup = std::stoi(value());
+        else if (arg == "--runs") o.runs = std::max(1, std::stoi(value()));
+        else if (arg == "--threads") o.threads = static_cast<unsigned>(std::stoul(value()));
+        else if (arg == "--seed") o.seed = static_cast<unsigned>(std::stoul(value()));
+        else if (arg == "--prefilter") o.prefilter = true;
+        else if (arg == "--format") o.format = value();
+        else if (arg == "--out") o.out = value();
+        else return false;
+    }
+    return o.format == "table" || o.format == "csv" || o.format == "json";
+}
+
+static std::vector<Point> makePoints(const std::string& provider, int n, unsigned seed) {
+    const long width = LONG_MAX;
+    const long height = LONG_MAX;
+    if (provider == "random") {
+        RandomPointProvider p(n, width, height, 0);
+        p.setSeed(seed);
+        return p.getPoints();
+    }
+    if (provider == "square") return SquarePointProvider(n, width, height, 0).getPoints();
+    if (provider == "line") return LinePointProvider(n, width, height, 0).getPoints();
+    if (provider == "circle") return CirclePointProvider(n, width, height, 0).getPoints();
+    throw std::invalid_argument("unknown provider " + provider);
+}
+
+static std::unique_ptr<IAlgorithm> makeAlgorithm(const std::string& name, unsigned threads) {
+    if (name == "andrew") {
+        auto alg = std::make_unique<AndrewAlgorithm>(std::vector<Point>{});
+        alg->setThreadCount(threads);
+        return alg;
+    }
+    if (name == "quickhull") {
+        auto alg = std::make_unique<QuickHullAlgorithm>(std::vector<Point>{});
+        alg->setThreadCount(threads);
+        return alg;
+    }
+    if (name == "chan") {
+        auto alg = std::make_unique<ChanAlgorithm>(std::vector<Point>{});
+        alg->setThreadCount(threads);
+        return alg;
+    }
+    throw std::invalid_argument("unknown algorithm " + name);
+}
+
+static Result measure(const Options& o, const std::string& provider, const std::string& algorithm,
+                      int n, const std::vector<Point>& points) {
+    std::unique_ptr<IAlgorithm> alg = makeAlgorithm(algorithm, o.threads);
+    if (o.prefilter) {
+        alg = std::make_unique<FilteredAlgorithm>(std::move(alg));
+    }
+
+    size_t hullSize = 0;
+    for (int i = 0; i < o.warmup; i++) {
+        hullSize = alg->runCompleteAlgorithm(points).size();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(o.runs));
+    for (int i = 0; i < o.runs; i++) {
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::vector<Point> hull = alg->runCompleteAlgorithm(points);
+        const auto t1 = std::chrono::steady_clock::now();
+        hullSize = hull.size();
+        samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+    }
+
+    return {provider, algorithm + (o.prefilter ? "+filter" : ""), n, points.size(), hullSize,
+            BenchStats::fromSamples(std::move(samples))};
+}
+
+static void writeTable(std::ostream& os, const std::vector<Result>& results) {
+    os << std::left << std::setw(8) << "Pattern" << std::setw(18) << "Algorithm"
+       << std::right << std::setw(10) << "Points" << std::setw(8) << "Hull"
+       << std::setw(14) << "Median(ns)" << std::setw(14) << "P95(ns)"
+       << std::setw(14) << "Stddev(ns)" << std::setw(6) << "Runs" << '\n';
+    os << std::fixed << std::setprecision(0);
+    for (const auto& r : results) {
+        os << std::left << std::setw(8) << r.provider << std::setw(18) << r.algorithm
+           << std::right << std::setw(10) << r.points << std::setw(8) << r.hullSize
+           << std::setw(14) << r.stats.median << std::setw(14) << r.stats.p95
+           << std::setw(14) << r.stats.stddev << std::setw(6) << r.stats.runs << '\n';
+    }
+}
+
+static void writeCsv(std::ostream& os, const std::vector<Result>& results) {
+    os << "provider,algorithm,requested,points,hull,runs,min_ns,median_ns,p95_ns,mean_ns,stddev_ns,max_ns\n";
+    os << std::fixed << std::setprecision(1);
+    for (const auto& r : results) {
+        os << r.provider << ',' << r.algorithm << ',' << r.requested << ',' << r.points << ','
+           << r.hullSize << ',' << r.stats.runs << ',' << r.stats.min << ',' << r.stats.median << ','
+           << r.stats.p95 << ',' << r.stats.mean << ',' << r.stats.stddev << ',' << r.stats.max << '\n';
+    }
+}
+
+static void writeJson(std::ostream& os, const Options& o, const std::vector<Result>& results) {
+    os << std::fixed << std::setprecision(1);
+    os << "{\n  \"warmup\": " << o.warmup << ",\n  \"runs\": " << o.runs
+       << ",\n  \"threads\": " << o.threads << ",\n  \"seed\": " << o.seed
+       << ",\n  \"prefilter\": " << (o.prefilter ? "true" : "false") << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        os << "    {\"provider\": \"" << r.provider << "\", \"algorithm\": \"" << r.algorithm
+           << "\", \"requested\": " << r.requested << ", \"points\": " << r.points
+           << ", \"hull\": " << r.hullSize << ", \"runs\": " << r.stats.runs
+           << ", \"min_ns\": " << r.stats.min << ", \"median_ns\": " << r.stats.median
+           << ", \"p95_ns\": " << r.stats.p95 << ", \"mean_ns\": " << r.stats.mean
+           << ", \"stddev_ns\": " << r.stats.stddev << ", \"max_ns\": " << r.stats.max << "}"
+           << (i + 1 < results.size() ? "," : "") << '\n';
+    }
+    os << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    Options o;
+    try {
+        if (!parseOptions(argc, argv, o)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Result> results;
+    try {
+        for (const auto& provider : o.providers) {
+            for (int n : o.sizes) {
+                const std::vector<Point> points = makePoints(provider, n, o.seed);
+                for (const auto& algorithm : o.algorithms) {
+                    results.push_back(measure(o, provider, algorithm, n, points));
+                    // Progress goes to stderr so stdout stays machine readable
+                    std::cerr << provider << ' ' << n << ' ' << results.back().algorithm << " done\n";
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    std::ofstream file;
+    if (!o.out.empty()) {
+        file.open(o.out);
+        if (!file.is_open()) {
+            std::cerr << "Cannot write " << o.out << '\n';
+            return 1;
+        }
+    }
+    std::ostream& os = o.out.empty() ? std::cout : file;
+
+    if (o.format == "csv") writeCsv(os, results);
+    else if (o.format == "json") writeJson(os, o, results);
+    else writeTable(os, results);
+    return 0;
+}
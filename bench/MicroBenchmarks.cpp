@@ -0,0 +1,492 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "algorithms/AklToussaintFilter.h"
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/BatchHull.h"
+#include "algorithms/DynamicHull.h"
+#include "algorithms/Orientation.h"
+#include "algorithms/OrientationKernels.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "algorithms/RadixSort.h"
+#include "algorithms/SlidingWindowHull.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/LinePointProvider.h"
+#include "point_providers/PointSoA.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+// Micro benchmarks for the individual kernels of the algorithms.
+// Every benchmark takes (distribution, size) as arguments, see applySizes.
+
+enum Distribution { RANDOM, SQUARE, LINE, CIRCLE };
+
+static const char* distributionName(int d) {
+    switch (d) {
+        case RANDOM: return "random";
+        case SQUARE: return "square";
+        case LINE: return "line";
+        default: return "circle";
+    }
+}
+
+static std::vector<Point> makePoints(int distribution, int n) {
+    const long extent = LONG_MAX;
+    switch (distribution) {
+        case RANDOM: {
+            RandomPointProvider p(n, extent, extent, 0);
+            p.setSeed(42);
+            return p.getPoints();
+        }
+        case SQUARE: return SquarePointProvider(n, extent, extent, 0).getPoints();
+        case LINE: return LinePointProvider(n, extent, extent, 0).getPoints();
+        default: return CirclePointProvider(n, extent, extent, 0).getPoints();
+    }
+}
+
+static void applySizes(benchmark::internal::Benchmark* b) {
+    for (int d : {RANDOM, SQUARE, LINE, CIRCLE}) {
+        for (int n : {1 << 10, 1 << 14, 1 << 18, 1 << 20}) {
+            // The circle provider is limited to 10000 points
+            if (d == CIRCLE && n > 10000) continue;
+            b->Args({d, n});
+        }
+    }
+    b->ArgNames({"dist", "n"});
+}
+
+static void finish(benchmark::State& state, size_t n) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+    state.SetLabel(distributionName(static_cast<int>(state.range(0))));
+}
+
+static Point leftmost(const std::vector<Point>& points) {
+    return *std::min_element(points.begin(), points.end());
+}
+
+static Point rightmost(const std::vector<Point>& points) {
+    return *std::max_element(points.begin(), points.end());
+}
+
+// Point providers
+
+static void BM_Provider(benchmark::State& state) {
+    const int d = static_cast<int>(state.range(0));
+    const int n = static_cast<int>(state.range(1));
+    for (auto _ : state) {
+        auto points = makePoints(d, n);
+        benchmark::DoNotOptimize(points.data());
+    }
+    finish(state, static_cast<size_t>(n));
+}
+BENCHMARK(BM_Provider)->Apply(applySizes);
+
+// Andrew: input sort and chain building
+
+static void BM_AndrewSort(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    std::vector<Point> work;
+    for (auto _ : state) {
+        state.PauseTiming();
+        work = points;
+        state.ResumeTiming();
+        AndrewAlgorithm::sortPoints(work);
+        benchmark::DoNotOptimize(work.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewSort)->Apply(applySizes);
+
+// LSD radix sort, serial and with the histogram pass on 4 threads
+static void BM_AndrewRadixSort(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    std::unique_ptr<WorkStealingPool> pool;
+    if (state.range(2) > 1) pool = std::make_unique<WorkStealingPool>(static_cast<unsigned>(state.range(2)));
+    std::vector<Point> work;
+    std::vector<Point> scratch;
+    for (auto _ : state) {
+        state.PauseTiming();
+        work = points;
+        state.ResumeTiming();
+        radixSortPoints(work, scratch, pool.get());
+        benchmark::DoNotOptimize(work.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewRadixSort)->Apply([](benchmark::internal::Benchmark* b) {
+    for (int threads : {1, 4}) {
+        for (int d : {RANDOM, SQUARE, LINE, CIRCLE}) {
+            for (int n : {1 << 10, 1 << 14, 1 << 18, 1 << 20}) {
+                if (d == CIRCLE && n > 10000) continue;
+                b->Args({d, n, threads});
+            }
+        }
+    }
+    b->ArgNames({"dist", "n", "threads"});
+});
+
+static void BM_AndrewAddPointToChain(benchmark::State& state) {
+    auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AndrewAlgorithm::sortPoints(points);
+    std::vector<Point> chain;
+    chain.reserve(points.size());
+    for (auto _ : state) {
+        chain.clear();
+        for (const auto& p : points) {
+            AndrewAlgorithm::addPointToChain(chain, p);
+        }
+        benchmark::DoNotOptimize(chain.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewAddPointToChain)->Apply(applySizes);
+
+// QuickHull: farthest-point scan and side partition against the leftmost/rightmost line
+
+static void BM_QuickHullFindFarthest(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const Point a = leftmost(points);
+    const Point b = rightmost(points);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(QuickHullAlgorithm::findFarthest(a, b, points));
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullFindFarthest)->Apply(applySizes);
+
+static void BM_QuickHullGetPointsOnSide(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const Point a = leftmost(points);
+    const Point b = rightmost(points);
+    for (auto _ : state) {
+        auto side = QuickHullAlgorithm::getPointsOnSide(a, b, points, true);
+        benchmark::DoNotOptimize(side.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullGetPointsOnSide)->Apply(applySizes);
+
+// Vectorized kernels on structure-of-arrays input
+
+static void BM_KernelArgmaxDistance(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const PointSoA soa(points);
+    const Point a = leftmost(points);
+    const Point b = rightmost(points);
+    const auto extent = OrientationKernels::extentOf(soa.x(), soa.y(), soa.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(OrientationKernels::argmaxDistance(soa.x(), soa.y(), soa.size(), a, b, extent));
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_KernelArgmaxDistance)->Apply(applySizes);
+
+static void BM_KernelPartitionBySide(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const PointSoA soa(points);
+    PointSoA out;
+    out.resize(soa.size());
+    const Point a = leftmost(points);
+    const Point b = rightmost(points);
+    const auto extent = OrientationKernels::extentOf(soa.x(), soa.y(), soa.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(OrientationKernels::partitionBySide(soa.x(), soa.y(), soa.size(), a, b, extent,
+                                                                     out.x(), out.y()));
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_KernelPartitionBySide)->Apply(applySizes);
+
+// Akl-Toussaint prefilter
+
+static void BM_AklToussaintFilter(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AklToussaintFilter filter;
+    for (auto _ : state) {
+        auto kept = filter.apply(points);
+        benchmark::DoNotOptimize(kept.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AklToussaintFilter)->Apply(applySizes);
+
+// Point updates: one point expires and a new one arrives, then the hull is read.
+// DynamicHull updates in polylogarithmic time, AndrewAlgorithm recomputes everything.
+
+static void BM_DynamicHullUpdate(benchmark::State& state) {
+    auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const auto arrivals = makePoints(RANDOM, 1 << 12);
+    DynamicHull hull(points);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const size_t slot = i % points.size();
+        hull.erase(points[slot]);
+        points[slot] = arrivals[i % arrivals.size()];
+        hull.insert(points[slot]);
+        benchmark::DoNotOptimize(hull.hull().size());
+        i++;
+    }
+    finish(state, 1);
+}
+BENCHMARK(BM_DynamicHullUpdate)->Apply(applySizes);
+
+static void BM_AndrewRecompute(benchmark::State& state) {
+    auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const auto arrivals = makePoints(RANDOM, 1 << 12);
+    AndrewAlgorithm andrew({});
+
+    size_t i = 0;
+    for (auto _ : state) {
+        points[i % points.size()] = arrivals[i % arrivals.size()];
+        benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(points).size());
+        i++;
+    }
+    finish(state, 1);
+}
+BENCHMARK(BM_AndrewRecompute)->Apply(applySizes);
+
+// Sliding window over a generated stream: every tick one point arrives and the
+// hull of the last n points is read
+
+static void BM_SlidingWindowTick(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(1));
+    const auto stream = makePoints(static_cast<int>(state.range(0)), 2 * n);
+    SlidingWindowHull window(SlidingWindowHull::Window::COUNT, n);
+    for (int i = 0; i < n; i++) window.push(stream[i]);
+
+    size_t i = n;
+    for (auto _ : state) {
+        window.push(stream[i++ % stream.size()]);
+        benchmark::DoNotOptimize(window.hull().size());
+    }
+    finish(state, 1);
+}
+BENCHMARK(BM_SlidingWindowTick)->Apply(applySizes);
+
+static void BM_SlidingWindowRecompute(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(1));
+    const auto stream = makePoints(static_cast<int>(state.range(0)), 2 * n);
+    std::deque<Point> window(stream.begin(), stream.begin() + n);
+    AndrewAlgorithm andrew({});
+
+    size_t i = n;
+    for (auto _ : state) {
+        window.pop_front();
+        window.push_back(stream[i++ % stream.size()]);
+        const std::vector<Point> points(window.begin(), window.end());
+        benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(points).size());
+    }
+    finish(state, 1);
+}
+BENCHMARK(BM_SlidingWindowRecompute)->Apply(applySizes);
+
+// Orientation predicate: the filtered float evaluation against the plain float cross
+// product it replaced, over consecutive input triples
+
+static void BM_OrientationCross(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        int positive = 0;
+        for (size_t i = 0; i + 2 < points.size(); ++i) {
+            positive += Orientation::cross(points[i], points[i + 1], points[i + 2]) > 0;
+        }
+        benchmark::DoNotOptimize(positive);
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_OrientationCross)->Apply(applySizes);
+
+static void BM_PlainFloatCross(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        int positive = 0;
+        for (size_t i = 0; i + 2 < points.size(); ++i) {
+            const Point& o = points[i];
+            const Point& a = points[i + 1];
+            const Point& b = points[i + 2];
+            positive += (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x) > 1e-9f;
+        }
+        benchmark::DoNotOptimize(positive);
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_PlainFloatCross)->Apply(applySizes);
+
+// Complete Andrew runs on the same points with each coordinate type: the float filter
+// against the exact double, int32 and int64 predicates
+
+template <class T>
+static std::vector<BasicPoint<T>> convertPoints(const std::vector<Point>& points) {
+    std::vector<BasicPoint<T>> converted;
+    converted.reserve(points.size());
+    for (const Point& p : points) {
+        // float(INT_MAX) is 2^31, which int32 cannot hold
+        converted.push_back({static_cast<T>(std::clamp<double>(p.x, INT_MIN, INT_MAX)),
+                             static_cast<T>(std::clamp<double>(p.y, INT_MIN, INT_MAX))});
+    }
+    return converted;
+}
+
+template <class T>
+static void BM_AndrewCoordinates(benchmark::State& state) {
+    const auto points = convertPoints<T>(makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+    BasicAndrewAlgorithm<T> andrew({});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(points).size());
+    }
+    finish(state, points.size());
+}
+BENCHMARK_TEMPLATE(BM_AndrewCoordinates, float)->Apply(applySizes);
+BENCHMARK_TEMPLATE(BM_AndrewCoordinates, double)->Apply(applySizes);
+#ifdef __SIZEOF_INT128__
+BENCHMARK_TEMPLATE(BM_AndrewCoordinates, std::int32_t)->Apply(applySizes);
+BENCHMARK_TEMPLATE(BM_AndrewCoordinates, std::int64_t)->Apply(applySizes);
+#endif
+
+// Many small sets of 10..500 points, n points in total: one batch call against one
+// AndrewAlgorithm run per set
+
+static std::vector<size_t> makeOffsets(size_t n) {
+    std::vector<size_t> offsets{0};
+    unsigned state = 1;
+    while (offsets.back() < n) {
+        state = state * 1103515245u + 12345u;
+        offsets.push_back(std::min(n, offsets.back() + 10 + (state >> 16) % 491));
+    }
+    return offsets;
+}
+
+static void BM_BatchHull(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const auto offsets = makeOffsets(points.size());
+    BatchHull batch;
+    BatchHull::Output out;
+
+    for (auto _ : state) {
+        batch.compute(points, offsets, out);
+        benchmark::DoNotOptimize(out.points.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_BatchHull)->Apply(applySizes);
+
+static void BM_AndrewPerSet(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const auto offsets = makeOffsets(points.size());
+    AndrewAlgorithm andrew({});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i + 1 < offsets.size(); i++) {
+            const std::vector<Point> set(points.begin() + offsets[i], points.begin() + offsets[i + 1]);
+            benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(set).size());
+        }
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewPerSet)->Apply(applySizes);
+
+// Repeated complete runs: the vector API against computeHull with a reused workspace
+// and output buffer
+
+static void BM_AndrewVectorApi(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AndrewAlgorithm andrew({});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(points).size());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewVectorApi)->Apply(applySizes);
+
+static void BM_AndrewRadixMode(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AndrewAlgorithm andrew({});
+    andrew.setSortMode(AndrewAlgorithm::SortMode::RADIX);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(andrew.runCompleteAlgorithm(points).size());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewRadixMode)->Apply(applySizes);
+
+static void BM_AndrewWorkspace(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AndrewAlgorithm::Workspace workspace;
+    std::vector<Point> hull;
+    for (auto _ : state) {
+        AndrewAlgorithm::computeHull(points, hull, workspace);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewWorkspace)->Apply(applySizes);
+
+static void BM_QuickHullVectorApi(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    QuickHullAlgorithm quickHull({});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(quickHull.runCompleteAlgorithm(points).size());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullVectorApi)->Apply(applySizes);
+
+static void BM_QuickHullWorkspace(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    QuickHullAlgorithm::Workspace workspace;
+    std::vector<Point> hull;
+    for (auto _ : state) {
+        QuickHullAlgorithm::computeHull(points, hull, workspace);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullWorkspace)->Apply(applySizes);
+
+// Index mode: the same runs reporting positions in the input
+
+static void BM_AndrewIndices(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    AndrewAlgorithm::Workspace workspace;
+    std::vector<std::uint32_t> hull;
+    for (auto _ : state) {
+        AndrewAlgorithm::computeHullIndices(points, hull, workspace);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_AndrewIndices)->Apply(applySizes);
+
+static void BM_QuickHullIndices(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    QuickHullAlgorithm::Workspace workspace;
+    std::vector<std::uint32_t> hull;
+    for (auto _ : state) {
+        QuickHullAlgorithm::computeHullIndices(points, hull, workspace);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullIndices)->Apply(applySizes);
+
+// Step mode: a reset and every preview and commit step up to the finished hull
+
+static void BM_QuickHullStepping(benchmark::State& state) {
+    const auto points = makePoints(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    QuickHullAlgorithm quickHull({});
+    for (auto _ : state) {
+        quickHull.reset(points);
+        while (quickHull.step()) {}
+        benchmark::DoNotOptimize(quickHull.isFinished());
+    }
+    finish(state, points.size());
+}
+BENCHMARK(BM_QuickHullStepping)->Apply(applySizes);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,12 @@
 #include <iostream>
+#include <thread>
 #include "visualization/App.h"
 #include "point_providers/RandomPointProvider.h"
 #include "point_providers/FromFilePointProvider.h"
+#include "point_providers/MappedPointProvider.h"
 #include "algorithms/AndrewAlgorithm.h"
 #include "algorithms/QuickhullAlgorithm.h"
+#include "algorithms/ChanAlgorithm.h"
 #include "performance/Performance.h"
 #include "point_providers/CirclePointProvider.h"
 #include "point_providers/LinePointProvider.h"
@@ -53,10 +56,23 @@ void getPoints(long width, long height, int margin, std::vector<Point> &points)
         // consumes points from file and stores them in a vector
         while (points.empty()) {
             std::string filename;
-            std::cout << "Enter filename (e.g., ../point_files/square.txt): " << std::endl;
+            std::cout << "Enter filename (e.g., ../point_files/square.txt or a .bin file): " << std::endl;
             std::cin >> filename;
-            FromFilePointProvider provider(filename);
-            points = provider.getPoints();
+            if (filename.ends_with(".bin")) {
+                MappedPointProvider provider(filename);
+                points = provider.getPoints();
+            } else {
+                FromFilePointProvider provider(filename);
+                provider.setThreadCount(std::thread::hardware_concurrency());
+                points = provider.getPoints();
+
+                for (const auto& error : provider.getErrors()) {
+                    std::cout << "Skipped malformed line " << error.line << ": " << error.text << std::endl;
+                }
+                if (provider.getMalformedLineCount() > provider.getErrors().size()) {
+                    std::cout << "... " << provider.getMalformedLineCount() << " malformed lines in total" << std::endl;
+                }
+            }
 
             if (points.empty()) {
                 std::cout << "File not found! Please try again." << std::endl;
@@ -65,6 +81,13 @@ void getPoints(long width, long height, int margin, std::vector<Point> &points)
     }
 }
 
+bool askPrefilter() {
+    std::cout << "Use the Akl-Toussaint prefilter? (1. yes, 2. no)" << std::endl;
+    int choice{2};
+    std::cin >> choice;
+    return choice == 1;
+}
+
 int main() {
     std::cout << "Choose mode:\n1. Visualization\n2. Performance\n3. Protocol\n> ";
     int mode;
@@ -72,6 +95,7 @@ int main() {
     int width {1200};
     int height {800};
     int fps {60};
+    int stepsPerSecond {6};
     int margin {50};
 
     if (mode == 1) {
@@ -83,24 +107,27 @@ int main() {
         App app(width, height, fps, points, std::move(algo));
 
         app.setAlgorithms(
-            {"Andrew", "QuickHull"},
+            {"Andrew", "QuickHull", "Chan"},
             {
                 [points]{ return std::make_unique<AndrewAlgorithm>(points); },
-                [points]{ return std::make_unique<QuickHullAlgorithm>(points); }
+                [points]{ return std::make_unique<QuickHullAlgorithm>(points); },
+                [points]{ return std::make_unique<ChanAlgorithm>(points); }
             },
             0
         );
+        app.setStepsPerSecond(stepsPerSecond);
 
         app.run();
     } else if (mode == 2) {
         std::cout << "\n--- PERFORMANCE MODE ---\n";
         std::vector<Point> points;
         getPoints(width, height, margin, points);
+        bool usePrefilter = askPrefilter();
 
-        Performance::runAlgorithms(points);
+        Performance::runAlgorithms(points, usePrefilter);
     } else if (mode == 3) {
         std::cout << "\n--- PROTOCOL MODE ---\n\n";
-        Protocol runner{};
+        Protocol runner{askPrefilter()};
         runner.run();
         return 0;
     }
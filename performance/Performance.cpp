@@ -3,14 +3,10 @@
 #include <chrono>
 #include "../algorithms/AndrewAlgorithm.h"
 #include "../algorithms/QuickhullAlgorithm.h"
+#include "../algorithms/FilteredAlgorithm.h"
 #include <vector>
-#include <string>
 #include <algorithm>
-#include <unordered_set>
-
-static std::string key(int x, int y) {
-    return std::to_string(x) + "," + std::to_string(y);
-}
+#include <iterator>
 
 static bool lessXY(const Point& a, const Point& b) {
     if (a.x != b.x) return a.x < b.x;
@@ -25,13 +21,13 @@ void printPointDiff(const std::vector<Point>& hullA,
     std::sort(a.begin(), a.end(), lessXY);
     std::sort(q.begin(), q.end(), lessXY);
 
-    std::unordered_set<std::string> setA;
-    std::unordered_set<std::string> setQ;
-    setA.reserve(a.size() * 2);
-    setQ.reserve(q.size() * 2);
-
-    for (const auto& p : a) setA.insert(key(p.x, p.y));
-    for (const auto& p : q) setQ.insert(key(p.x, p.y));
+    // Both lists are sorted, so the differences are merges on the exact coordinates
+    std::vector<Point> onlyA;
+    std::vector<Point> onlyQ;
+    std::vector<Point> both;
+    std::set_difference(a.begin(), a.end(), q.begin(), q.end(), std::back_inserter(onlyA), lessXY);
+    std::set_difference(q.begin(), q.end(), a.begin(), a.end(), std::back_inserter(onlyQ), lessXY);
+    std::set_intersection(a.begin(), a.end(), q.begin(), q.end(), std::back_inserter(both), lessXY);
 
     const char* red = "\033[31m";
     const char* green = "\033[32m";
@@ -39,67 +35,63 @@ void printPointDiff(const std::vector<Point>& hullA,
     const char* reset = "\033[0m";
 
     std::cout << "\nMissing in Q:\n";
-    size_t miss_in_q = 0;
-    for (const auto& p : a) {
-        std::string k = key(p.x, p.y);
-        if (setQ.find(k) == setQ.end()) {
-            ++miss_in_q;
-            std::cout << red << "[A only] " << reset << p.x << "," << p.y << "\n";
-        }
+    for (const auto& p : onlyA) {
+        std::cout << red << "[A only] " << reset << p.x << "," << p.y << "\n";
     }
 
     std::cout << "\nMissing in A:\n";
-    size_t miss_in_a = 0;
-    for (const auto& p : q) {
-        std::string k = key(p.x, p.y);
-        if (setA.find(k) == setA.end()) {
-            ++miss_in_a;
-            std::cout << yellow << "[Q only] " << reset << p.x << "," << p.y << "\n";
-        }
+    for (const auto& p : onlyQ) {
+        std::cout << yellow << "[Q only] " << reset << p.x << "," << p.y << "\n";
     }
 
     std::cout << "\nCommon points:\n";
-    size_t common = 0;
-    size_t i = 0, j = 0;
-    while (i < a.size() && j < q.size()) {
-        if (a[i].x == q[j].x && a[i].y == q[j].y) {
-            ++common;
-            std::cout << green << "[both] " << reset << a[i].x << "," << a[i].y << "\n";
-            ++i;
-            ++j;
-        } else if (lessXY(a[i], q[j])) {
-            ++i;
-        } else {
-            ++j;
-        }
+    for (const auto& p : both) {
+        std::cout << green << "[both] " << reset << p.x << "," << p.y << "\n";
     }
 
     std::cout << "\nSummary:\n";
     std::cout << "A count: " << a.size() << "\n";
     std::cout << "Q count: " << q.size() << "\n";
-    std::cout << "Common: " << common << "\n";
-    std::cout << "Missing in Q: " << miss_in_q << "\n";
-    std::cout << "Missing in A: " << miss_in_a << "\n";
+    std::cout << "Common: " << both.size() << "\n";
+    std::cout << "Missing in Q: " << onlyA.size() << "\n";
+    std::cout << "Missing in A: " << onlyQ.size() << "\n";
 }
 
-void Performance::runAlgorithms(const std::vector<Point>& points) {
+void Performance::runAlgorithms(const std::vector<Point>& points, bool usePrefilter) {
     if (points.empty()) {
         std::cerr << "No points to process.\n";
         return;
     }
 
-    std::cout << "\nRunning performance test with " << points.size() << " points...\n";
+    std::cout << "\nRunning performance test with " << points.size() << " points";
+    if (usePrefilter) std::cout << " (Akl-Toussaint prefilter on)";
+    std::cout << "...\n";
     std::cout << "--------------------------------------------------------\n";
 
+    // The prefilter runs inside the timed region, it is part of the algorithm's cost
+    size_t culledA = 0;
     auto startA = std::chrono::high_resolution_clock::now();
-    AndrewAlgorithm andrew(points);
-    auto hullA = andrew.runCompleteAlgorithm(points);
+    std::vector<Point> hullA;
+    if (usePrefilter) {
+        FilteredAlgorithm andrew(std::make_unique<AndrewAlgorithm>(std::vector<Point>{}));
+        hullA = andrew.runCompleteAlgorithm(points);
+        culledA = andrew.getCulledCount();
+    } else {
+        AndrewAlgorithm andrew(points);
+        hullA = andrew.runCompleteAlgorithm(points);
+    }
     auto endA = std::chrono::high_resolution_clock::now();
     auto durationA = std::chrono::duration_cast<std::chrono::nanoseconds>(endA - startA).count();
 
     auto startQ = std::chrono::high_resolution_clock::now();
-    QuickHullAlgorithm quick(points);
-    auto hullQ = quick.runCompleteAlgorithm(points);
+    std::vector<Point> hullQ;
+    if (usePrefilter) {
+        FilteredAlgorithm quick(std::make_unique<QuickHullAlgorithm>(std::vector<Point>{}));
+        hullQ = quick.runCompleteAlgorithm(points);
+    } else {
+        QuickHullAlgorithm quick(points);
+        hullQ = quick.runCompleteAlgorithm(points);
+    }
     auto endQ = std::chrono::high_resolution_clock::now();
     auto durationQ = std::chrono::duration_cast<std::chrono::nanoseconds>(endQ - startQ).count();
 
@@ -108,6 +100,9 @@ void Performance::runAlgorithms(const std::vector<Point>& points) {
     std::cout << "Andrew's Algorithm   " << durationA << "ns\t\t" << hullA.size() << '\n';
     std::cout << "QuickHull Algorithm  " << durationQ << "ns\t\t" << hullQ.size() << '\n';
     std::cout << "--------------------------------------------------------\n";
+    if (usePrefilter) {
+        std::cout << "Prefilter culled " << culledA << " of " << points.size() << " points\n";
+    }
 
     if (hullA.size() != hullQ.size()) {
         std::cout << "Warning: Hull sizes differ! ("
@@ -6,7 +6,7 @@
 
 class Performance {
 public:
-    static void runAlgorithms(const std::vector<Point>& points);
+    static void runAlgorithms(const std::vector<Point>& points, bool usePrefilter = false);
 };
 
 #endif //PERFORMANCE_H
@@ -0,0 +1,57 @@
+#include "BinaryPointFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+size_t coordinateSize(uint32_t coordinateType) {
+    switch (static_cast<CoordinateType>(coordinateType)) {
+        case CoordinateType::FLOAT32: return sizeof(float);
+        case CoordinateType::FLOAT64: return sizeof(double);
+    }
+    return 0;
+}
+
+bool isValidBinaryHeader(const BinaryPointHeader& header, size_t fileSize) {
+    if (std::memcmp(header.magic, "CHPT", 4) != 0) return false;
+    if (header.version != BINARY_POINT_VERSION) return false;
+
+    const size_t size = coordinateSize(header.coordinateType);
+    if (size == 0 || fileSize < BINARY_POINT_DATA_OFFSET) return false;
+
+    // Compare by division so a corrupt count cannot overflow
+    return header.count <= (fileSize - BINARY_POINT_DATA_OFFSET) / (2 * size);
+}
+
+bool writeBinaryPoints(const std::string& filename, std::span<const Point> points) {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    BinaryPointHeader header{};
+    std::memcpy(header.magic, "CHPT", 4);
+    header.version = BINARY_POINT_VERSION;
+    header.coordinateType = static_cast<uint32_t>(CoordinateType::FLOAT32);
+    header.count = points.size();
+
+    if (!points.empty()) {
+        header.flags |= BINARY_POINT_HAS_BOUNDS;
+        header.minX = header.maxX = points[0].x;
+        header.minY = header.maxY = points[0].y;
+        for (const auto& p : points) {
+            header.minX = std::min<double>(header.minX, p.x);
+            header.minY = std::min<double>(header.minY, p.y);
+            header.maxX = std::max<double>(header.maxX, p.x);
+            header.maxY = std::max<double>(header.maxY, p.y);
+        }
+    }
+
+    char block[BINARY_POINT_DATA_OFFSET] = {};
+    std::memcpy(block, &header, sizeof(header));
+    file.write(block, sizeof(block));
+
+    static_assert(sizeof(Point) == 2 * sizeof(float), "Point must be two packed floats");
+    file.write(reinterpret_cast<const char*>(points.data()),
+               static_cast<std::streamsize>(points.size() * sizeof(Point)));
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,45 @@
+#ifndef BINARYPOINTFORMAT_H
+#define BINARYPOINTFORMAT_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include "Point.h"
+
+// Binary point file (".bin"), little endian:
+//   BinaryPointHeader (64 bytes) followed by count (x, y) coordinate pairs.
+// The payload starts at a 64 byte offset, so a mapped FLOAT32 file can be read
+// in place as an array of Point.
+enum class CoordinateType : uint32_t {
+    FLOAT32 = 1,
+    FLOAT64 = 2,
+};
+
+struct BinaryPointHeader {
+    char magic[4];            // "CHPT"
+    uint32_t version;         // BINARY_POINT_VERSION
+    uint32_t coordinateType;  // CoordinateType
+    uint32_t flags;           // BINARY_POINT_HAS_BOUNDS
+    uint64_t count;
+    double minX;              // bounds, only meaningful with BINARY_POINT_HAS_BOUNDS
+    double minY;
+    double maxX;
+    double maxY;
+};
+
+static_assert(sizeof(BinaryPointHeader) == 56, "unexpected header padding");
+
+constexpr uint32_t BINARY_POINT_VERSION = 1;
+constexpr uint32_t BINARY_POINT_HAS_BOUNDS = 1u << 0;
+constexpr size_t BINARY_POINT_DATA_OFFSET = 64;
+
+// Size of one coordinate of the given type, 0 for unknown types
+size_t coordinateSize(uint32_t coordinateType);
+
+// Checks magic, version, coordinate type and that fileSize holds all points
+bool isValidBinaryHeader(const BinaryPointHeader& header, size_t fileSize);
+
+// Writes points as FLOAT32 with bounds; returns false if the file cannot be written
+bool writeBinaryPoints(const std::string& filename, std::span<const Point> points);
+
+#endif //BINARYPOINTFORMAT_H
@@ -1,34 +1,28 @@
 #include "FromFilePointProvider.h"
+#include "MappedFile.h"
 
 FromFilePointProvider::FromFilePointProvider(const std::string& filename)
     : m_filename(filename) {}
 
-std::vector<Point> FromFilePointProvider::getPoints() {
-    std::vector<Point> points;
-    std::ifstream file(m_filename);
-
-    if (!file.is_open()) {
-        return points;
+void FromFilePointProvider::setThreadCount(unsigned threadCount) {
+    if (threadCount <= 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != threadCount) {
+        m_pool = std::make_unique<WorkStealingPool>(threadCount);
     }
+}
 
-    int n;
-    file >> n;
-    points.reserve(n);
-
-    std::string line;
-    std::getline(file, line);
-
-    for (int i = 0; i < n; i++) {
-        if (!std::getline(file, line)) break;
+std::vector<Point> FromFilePointProvider::getPoints() {
+    m_errors.clear();
+    m_malformedLines = 0;
 
-        std::stringstream ss(line);
-        float x;
-        float y;
-        char comma;
-        if (ss >> x >> comma >> y) {
-            points.push_back({x, y});
-        }
+    MappedFile file(m_filename);
+    if (!file.isOpen()) {
+        return {};
     }
 
-    return points;
+    auto result = PointTextParser::parse(reinterpret_cast<const char*>(file.data()), file.size(), m_pool.get());
+    m_errors = std::move(result.errors);
+    m_malformedLines = result.malformedLines;
+    return std::move(result.points);
 }
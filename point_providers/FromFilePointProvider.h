@@ -2,10 +2,10 @@
 #define PRESETPOINTPROVIDER_H
 
 #include "IPointProvider.h"
+#include "PointTextParser.h"
+#include "algorithms/WorkStealingPool.h"
+#include <memory>
 #include <string>
-#include <fstream>
-#include <sstream>
-#include <stdexcept>
 
 class FromFilePointProvider : public IPointProvider {
 
@@ -14,8 +14,19 @@ public:
 
     std::vector<Point> getPoints() override;
 
+    // Large files are split at line boundaries and parsed by this many threads
+    void setThreadCount(unsigned threadCount);
+    unsigned getThreadCount() const { return m_pool ? m_pool->getThreadCount() : 1; }
+
+    // Malformed lines of the last getPoints() call; they are not part of the points
+    const std::vector<PointTextParser::LineError>& getErrors() const { return m_errors; }
+    size_t getMalformedLineCount() const { return m_malformedLines; }
+
 private:
     std::string m_filename;
+    std::unique_ptr<WorkStealingPool> m_pool;
+    std::vector<PointTextParser::LineError> m_errors;
+    size_t m_malformedLines = 0;
 
 };
 
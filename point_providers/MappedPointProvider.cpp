@@ -0,0 +1,39 @@
+#include "MappedPointProvider.h"
+#include <cstring>
+
+MappedPointProvider::MappedPointProvider(const std::string& filename)
+    : m_file(filename) {
+    if (!m_file.isOpen() || m_file.size() < sizeof(BinaryPointHeader)) {
+        return;
+    }
+
+    std::memcpy(&m_header, m_file.data(), sizeof(m_header));
+    m_valid = isValidBinaryHeader(m_header, m_file.size());
+
+    if (m_valid && m_header.coordinateType == static_cast<uint32_t>(CoordinateType::FLOAT64)) {
+        const std::byte* data = m_file.data() + BINARY_POINT_DATA_OFFSET;
+        m_converted.resize(m_header.count);
+        for (size_t i = 0; i < m_converted.size(); i++) {
+            double xy[2];
+            std::memcpy(xy, data + i * sizeof(xy), sizeof(xy));
+            m_converted[i] = {static_cast<float>(xy[0]), static_cast<float>(xy[1])};
+        }
+    }
+}
+
+std::span<const Point> MappedPointProvider::getSpan() const {
+    if (!m_valid) {
+        return {};
+    }
+    if (m_header.coordinateType == static_cast<uint32_t>(CoordinateType::FLOAT64)) {
+        return m_converted;
+    }
+    // The mapping is page aligned and the payload starts at a 64 byte offset
+    const auto* points = reinterpret_cast<const Point*>(m_file.data() + BINARY_POINT_DATA_OFFSET);
+    return {points, static_cast<size_t>(m_header.count)};
+}
+
+std::vector<Point> MappedPointProvider::getPoints() {
+    const auto points = getSpan();
+    return {points.begin(), points.end()};
+}
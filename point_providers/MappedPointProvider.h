@@ -0,0 +1,34 @@
+#ifndef MAPPEDPOINTPROVIDER_H
+#define MAPPEDPOINTPROVIDER_H
+
+#include "IPointProvider.h"
+#include "BinaryPointFormat.h"
+#include "MappedFile.h"
+#include <span>
+#include <string>
+#include <vector>
+
+// Loads a binary point file (see BinaryPointFormat.h) through a memory mapping.
+// FLOAT32 files are exposed in place by getSpan(); FLOAT64 files are converted once.
+class MappedPointProvider : public IPointProvider {
+public:
+    explicit MappedPointProvider(const std::string& filename);
+
+    std::vector<Point> getPoints() override;
+
+    // False if the file is missing, truncated or not in the binary format
+    bool isValid() const { return m_valid; }
+    const BinaryPointHeader& getHeader() const { return m_header; }
+    bool hasBounds() const { return m_valid && (m_header.flags & BINARY_POINT_HAS_BOUNDS); }
+
+    // View of the points, valid as long as the provider lives
+    std::span<const Point> getSpan() const;
+
+private:
+    MappedFile m_file;
+    BinaryPointHeader m_header{};
+    bool m_valid = false;
+    std::vector<Point> m_converted;
+};
+
+#endif //MAPPEDPOINTPROVIDER_H
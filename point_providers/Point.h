@@ -1,21 +1,45 @@
 #ifndef POINT_H
 #define POINT_H
 
-struct Point {
-    float x;
-    float y;
+#include <cstdint>
+#include <type_traits>
 
-    Point() = default;
-    Point(float xf, float yf) : x(xf), y(yf) {}
-    Point(int xi, int yi) : x(static_cast<float>(xi)), y(static_cast<float>(yi)) {}
+// Point with coordinates of type T. Point (float) is the type used throughout the
+// application; the hull algorithms are also instantiated for double, int32 and int64.
+template <class T>
+struct BasicPoint {
+    using Coordinate = T;
+
+    T x;
+    T y;
+
+    BasicPoint() = default;
+    BasicPoint(T xv, T yv) : x(xv), y(yv) {}
+    BasicPoint(int xi, int yi) requires (!std::is_same_v<T, int>)
+        : x(static_cast<T>(xi)), y(static_cast<T>(yi)) {}
 };
 
+// Point tagged with the position of its record in the caller's input: the index modes of
+// the hull algorithms sort and partition these pairs instead of the records themselves
+template <class T>
+struct BasicIndexedPoint {
+    BasicPoint<T> point;
+    std::uint32_t index;
+};
+
+using Point = BasicPoint<float>;
+using DoublePoint = BasicPoint<double>;
+using Int32Point = BasicPoint<std::int32_t>;
+using Int64Point = BasicPoint<std::int64_t>;
+
 // Comparison operators for Point to use in std::set
-inline bool operator<(const Point& a, const Point& b) {
+template <class T>
+inline bool operator<(const BasicPoint<T>& a, const BasicPoint<T>& b) {
     return (a.x < b.x) || (a.x == b.x && a.y < b.y);
 }
 
-inline bool operator==(const Point& a, const Point& b) {
+template <class T>
+inline bool operator==(const BasicPoint<T>& a, const BasicPoint<T>& b) {
     return a.x == b.x && a.y == b.y;
 }
 #endif //POINT_H
@@ -0,0 +1,73 @@
+#include "point_providers/PointQuadtree.h"
+#include <cmath>
+#include <limits>
+
+constexpr std::uint32_t GRID = 1u << PointQuadtree::MAX_DEPTH;
+
+// Spread the 16 low bits of v to the even bit positions
+static std::uint32_t spreadBits(std::uint32_t v) {
+    v &= 0xffff;
+    v = (v | (v << 8)) & 0x00ff00ff;
+    v = (v | (v << 4)) & 0x0f0f0f0f;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+std::uint32_t PointQuadtree::interleave(std::uint32_t x, std::uint32_t y) {
+    return spreadBits(x) | (spreadBits(y) << 1);
+}
+
+PointQuadtree::PointQuadtree(const std::vector<Point>& points) {
+    if (points.empty()) {
+        return;
+    }
+
+    float minX = points[0].x;
+    float minY = points[0].y;
+    float maxX = points[0].x;
+    float maxY = points[0].y;
+    for (const Point& p : points) {
+        minX = std::min(minX, p.x);
+        minY = std::min(minY, p.y);
+        maxX = std::max(maxX, p.x);
+        maxY = std::max(maxY, p.y);
+    }
+    // A square, so that cells are square on screen; extents near FLT_MAX are kept in double.
+    // It is a few ulps of the coordinates wide at least, so that identical points, or a
+    // spread below float resolution, still give cells of nonzero size.
+    const float magnitude = std::max({std::fabs(minX), std::fabs(minY), std::fabs(maxX), std::fabs(maxY)});
+    const double minExtent = std::max(static_cast<double>(magnitude) * 0x1p-22,
+                                      static_cast<double>(std::numeric_limits<float>::denorm_min()));
+    m_extent = std::max({static_cast<double>(maxX) - minX, static_cast<double>(maxY) - minY, minExtent});
+    m_bounds = {minX, minY, static_cast<float>(minX + m_extent), static_cast<float>(minY + m_extent)};
+
+    const double scale = GRID / m_extent;
+    auto gridCoordinate = [scale](float v, float origin) {
+        const double g = std::floor((static_cast<double>(v) - origin) * scale);
+        return static_cast<std::uint32_t>(std::clamp(g, 0.0, static_cast<double>(GRID - 1)));
+    };
+
+    std::vector<std::uint32_t> codes(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        codes[i] = interleave(gridCoordinate(points[i].x, minX), gridCoordinate(points[i].y, minY));
+    }
+
+    m_order.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        m_order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::stable_sort(m_order.begin(), m_order.end(),
+                     [&codes](std::uint32_t a, std::uint32_t b) { return codes[a] < codes[b]; });
+
+    m_codes.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        m_codes[i] = codes[m_order[i]];
+    }
+}
+
+PointQuadtree::Rect PointQuadtree::cellBounds(int depth, std::uint32_t x, std::uint32_t y) const {
+    const double size = m_extent / static_cast<double>(1u << depth);
+    return {static_cast<float>(m_bounds.minX + x * size), static_cast<float>(m_bounds.minY + y * size),
+            static_cast<float>(m_bounds.minX + (x + 1) * size), static_cast<float>(m_bounds.minY + (y + 1) * size)};
+}
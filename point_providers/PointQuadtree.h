@@ -0,0 +1,94 @@
+#ifndef POINTQUADTREE_H
+#define POINTQUADTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Point.h"
+
+// Implicit quadtree over a point set. The points are sorted by the Morton code of their
+// position on a 2^16 x 2^16 grid over their bounding square, so every quadtree cell is a
+// contiguous range of that order and the ranges of its children are found by binary
+// search inside it. Nothing but the order and the codes is stored.
+class PointQuadtree {
+public:
+    static constexpr int MAX_DEPTH = 16;
+
+    struct Rect {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    // A cell at depth (a 2^depth x 2^depth subdivision of bounds()) holding the
+    // points order()[begin, end)
+    struct Cell {
+        Rect bounds;
+        int depth;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    PointQuadtree() = default;
+    explicit PointQuadtree(const std::vector<Point>& points);
+
+    // Input positions in Morton order
+    const std::vector<std::uint32_t>& order() const { return m_order; }
+    // The bounding square of the points
+    const Rect& bounds() const { return m_bounds; }
+    std::size_t size() const { return m_order.size(); }
+
+    // Calls visit(cell) for the non-empty cells intersecting view, descending until a cell
+    // is no wider than minCellSize or has the maximum depth; the cells are disjoint and
+    // visited in Morton order. The work is proportional to the cells visited and their
+    // ancestors, not to the number of points.
+    template <class Visit>
+    void query(const Rect& view, float minCellSize, Visit&& visit) const {
+        if (!m_order.empty()) {
+            descend(view, minCellSize, 0, 0, 0, 0, m_order.size(), visit);
+        }
+    }
+
+private:
+    std::vector<std::uint32_t> m_order;
+    std::vector<std::uint32_t> m_codes;
+    Rect m_bounds{0, 0, 0, 0};
+    double m_extent = 0;
+
+    Rect cellBounds(int depth, std::uint32_t x, std::uint32_t y) const;
+
+    template <class Visit>
+    void descend(const Rect& view, float minCellSize, int depth, std::uint32_t x, std::uint32_t y,
+                 std::size_t begin, std::size_t end, Visit& visit) const {
+        const Rect r = cellBounds(depth, x, y);
+        if (r.maxX < view.minX || r.minX > view.maxX || r.maxY < view.minY || r.minY > view.maxY) {
+            return;
+        }
+        if (depth == MAX_DEPTH || r.maxX - r.minX <= minCellSize) {
+            visit(Cell{r, depth, begin, end});
+            return;
+        }
+
+        // Children in Morton order: the low bit of the quadrant is x, the high bit y
+        const int shift = 2 * (MAX_DEPTH - depth - 1);
+        const std::uint32_t prefix = interleave(x, y) << 2;
+        std::size_t childBegin = begin;
+        for (std::uint32_t quadrant = 0; quadrant < 4; ++quadrant) {
+            const std::uint64_t limit = (static_cast<std::uint64_t>(prefix) + quadrant + 1) << shift;
+            const std::size_t childEnd = static_cast<std::size_t>(
+                std::lower_bound(m_codes.begin() + childBegin, m_codes.begin() + end, limit) - m_codes.begin());
+            if (childEnd > childBegin) {
+                descend(view, minCellSize, depth + 1, 2 * x + (quadrant & 1), 2 * y + (quadrant >> 1),
+                        childBegin, childEnd, visit);
+            }
+            childBegin = childEnd;
+        }
+    }
+
+    // Bits of x at the even positions, bits of y at the odd ones
+    static std::uint32_t interleave(std::uint32_t x, std::uint32_t y);
+};
+
+#endif //POINTQUADTREE_H
@@ -0,0 +1,84 @@
+#ifndef POINTSOA_H
+#define POINTSOA_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include "Point.h"
+
+// Allocator returning storage aligned for 256-bit vector loads
+template <class T, std::size_t Alignment = 32>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <class U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() = default;
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <class U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+};
+
+// Structure-of-arrays point storage: x and y coordinates in separate aligned arrays,
+// so orientation kernels can load 4 or 8 coordinates of one kind at a time
+class PointSoA {
+public:
+    using Array = std::vector<float, AlignedAllocator<float>>;
+
+    PointSoA() = default;
+    explicit PointSoA(const std::vector<Point>& points) { assign(points); }
+
+    void assign(const std::vector<Point>& points) {
+        m_x.resize(points.size());
+        m_y.resize(points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            m_x[i] = points[i].x;
+            m_y[i] = points[i].y;
+        }
+    }
+
+    void resize(std::size_t n) {
+        m_x.resize(n);
+        m_y.resize(n);
+    }
+
+    void push_back(const Point& p) {
+        m_x.push_back(p.x);
+        m_y.push_back(p.y);
+    }
+
+    std::size_t size() const { return m_x.size(); }
+    bool empty() const { return m_x.empty(); }
+
+    float* x() { return m_x.data(); }
+    float* y() { return m_y.data(); }
+    const float* x() const { return m_x.data(); }
+    const float* y() const { return m_y.data(); }
+
+    Point operator[](std::size_t i) const { return {m_x[i], m_y[i]}; }
+
+    std::vector<Point> toPoints() const {
+        std::vector<Point> points;
+        points.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            points.push_back({m_x[i], m_y[i]});
+        }
+        return points;
+    }
+
+private:
+    Array m_x;
+    Array m_y;
+};
+
+#endif //POINTSOA_H
@@ -0,0 +1,151 @@
+#include "PointTextParser.h"
+#include "algorithms/WorkStealingPool.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+// Below this many bytes per thread the file is parsed on the calling thread
+constexpr size_t PARALLEL_BLOCK = 1 << 20;
+
+static const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
+}
+
+static const char* nextLine(const char* p, const char* end) {
+    const void* nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return nl ? static_cast<const char*>(nl) + 1 : end;
+}
+
+// Text of the line [begin, next) without its line break
+static std::string lineText(const char* begin, const char* next) {
+    std::string text(begin, next);
+    while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) text.pop_back();
+    return text;
+}
+
+bool PointTextParser::parseLine(const char* begin, const char* end, Point& out) {
+    const char* p = skipBlanks(begin, end);
+
+    float x;
+    float y;
+    auto rx = std::from_chars(p, end, x);
+    if (rx.ec != std::errc()) return false;
+
+    p = skipBlanks(rx.ptr, end);
+    if (p == end || *p != ',') return false;
+    p = skipBlanks(p + 1, end);
+
+    auto ry = std::from_chars(p, end, y);
+    if (ry.ec != std::errc()) return false;
+
+    if (skipBlanks(ry.ptr, end) != end) return false;
+    out = {x, y};
+    return true;
+}
+
+namespace {
+
+// Output of one newline-aligned block of the file
+struct Block {
+    const char* begin;
+    const char* end;
+    std::vector<Point> points;
+    std::vector<PointTextParser::LineError> errors;  // line numbers relative to the block
+    size_t malformed = 0;
+    size_t lines = 0;
+};
+
+void parseBlock(Block& block) {
+    const char* p = block.begin;
+    while (p < block.end) {
+        const char* next = nextLine(p, block.end);
+        const char* lineEnd = (next > p && next[-1] == '\n') ? next - 1 : next;
+
+        Point point;
+        if (PointTextParser::parseLine(p, lineEnd, point)) {
+            block.points.push_back(point);
+        } else {
+            if (block.errors.size() < PointTextParser::MAX_REPORTED_ERRORS) {
+                block.errors.push_back({block.lines, lineText(p, next)});
+            }
+            block.malformed++;
+        }
+        block.lines++;
+        p = next;
+    }
+}
+
+}
+
+PointTextParser::Result PointTextParser::parse(const char* data, size_t size, WorkStealingPool* pool) {
+    Result result;
+    const char* end = data + size;
+
+    // Count line
+    const char* headerEnd = nextLine(data, end);
+    const char* p = skipBlanks(data, headerEnd);
+    long declared = 0;
+    auto header = std::from_chars(p, headerEnd, declared);
+    if (header.ec != std::errc() || declared < 0) {
+        result.errors.push_back({1, lineText(data, headerEnd)});
+        result.malformedLines = 1;
+        return result;
+    }
+    result.validHeader = true;
+    result.declaredCount = static_cast<size_t>(declared);
+
+    // Only the declared number of lines is read, anything after it is ignored
+    const char* bodyEnd = headerEnd;
+    for (size_t i = 0; i < result.declaredCount && bodyEnd < end; i++) {
+        bodyEnd = nextLine(bodyEnd, end);
+    }
+
+    const size_t bodySize = static_cast<size_t>(bodyEnd - headerEnd);
+    const size_t threads = pool ? pool->getThreadCount() : 1;
+    const size_t blockCount = std::max<size_t>(1, std::min(threads, bodySize / PARALLEL_BLOCK));
+
+    // Split into equal byte ranges moved forward to the next line start
+    std::vector<Block> blocks(blockCount);
+    const char* blockBegin = headerEnd;
+    for (size_t i = 0; i < blockCount; i++) {
+        const char* blockEnd = bodyEnd;
+        if (i + 1 < blockCount) {
+            blockEnd = std::max(blockBegin, headerEnd + bodySize * (i + 1) / blockCount);
+            if (blockEnd > headerEnd && blockEnd[-1] != '\n') {
+                blockEnd = nextLine(blockEnd, bodyEnd);
+            }
+        }
+        blocks[i].begin = blockBegin;
+        blocks[i].end = blockEnd;
+        blocks[i].points.reserve(static_cast<size_t>(blockEnd - blockBegin) / 8);
+        blockBegin = blockEnd;
+    }
+
+    if (blockCount > 1) {
+        WorkStealingPool::TaskGroup tasks(*pool);
+        for (auto& block : blocks) {
+            tasks.run([&block] { parseBlock(block); });
+        }
+        tasks.wait();
+    } else {
+        parseBlock(blocks[0]);
+    }
+
+    size_t total = 0;
+    for (const auto& block : blocks) total += block.points.size();
+    result.points.reserve(total);
+
+    // Line numbers become absolute: the header is line 1
+    size_t lineOffset = 2;
+    for (auto& block : blocks) {
+        result.points.insert(result.points.end(), block.points.begin(), block.points.end());
+        for (auto& error : block.errors) {
+            if (result.errors.size() == MAX_REPORTED_ERRORS) break;
+            result.errors.push_back({error.line + lineOffset, std::move(error.text)});
+        }
+        result.malformedLines += block.malformed;
+        lineOffset += block.lines;
+    }
+    return result;
+}
@@ -0,0 +1,38 @@
+#ifndef POINTTEXTPARSER_H
+#define POINTTEXTPARSER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Point.h"
+
+class WorkStealingPool;
+
+// Parser for the text point format: a count line followed by "x,y" lines, where the
+// coordinates are integers or decimals. Built on std::from_chars; large inputs are
+// split at newline boundaries and parsed by the threads of a pool.
+class PointTextParser {
+public:
+    struct LineError {
+        size_t line;       // 1-based line number in the file
+        std::string text;  // the offending line (without the line break)
+    };
+
+    struct Result {
+        std::vector<Point> points;
+        std::vector<LineError> errors;  // first MAX_REPORTED_ERRORS malformed lines
+        size_t malformedLines = 0;      // total count, may exceed errors.size()
+        size_t declaredCount = 0;       // value of the count line
+        bool validHeader = false;
+    };
+
+    static constexpr size_t MAX_REPORTED_ERRORS = 100;
+
+    // Parses at most declaredCount lines after the header, like the original loader did
+    static Result parse(const char* data, size_t size, WorkStealingPool* pool = nullptr);
+
+    // Parses one "x,y" line (surrounding blanks allowed, no line break); false if malformed
+    static bool parseLine(const char* begin, const char* end, Point& out);
+};
+
+#endif //POINTTEXTPARSER_H
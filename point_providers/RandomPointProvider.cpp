@@ -1,4 +1,6 @@
 #include "RandomPointProvider.h"
+#include <algorithm>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -6,17 +8,30 @@ RandomPointProvider::RandomPointProvider(int count, long width, long height, int
     : m_count(count), m_width(width), m_height(height), m_margin(margin) {}
 
 std::vector<Point> RandomPointProvider::getPoints() {
+    const std::vector<Int32Point> integers = getIntegerPoints();
+
     std::vector<Point> points;
+    points.reserve(integers.size());
+    for (const Int32Point& p : integers) {
+        points.push_back(Point{p.x, p.y});
+    }
+    return points;
+}
+
+std::vector<Int32Point> RandomPointProvider::getIntegerPoints() {
+    std::vector<Int32Point> points;
     points.reserve(static_cast<size_t>(m_count));
 
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution distX(m_margin, static_cast<int>(m_width - m_margin));
-    std::uniform_int_distribution distY(m_margin, static_cast<int>(m_height - m_margin));
+    // Clamp to the int range, a LONG_MAX extent would otherwise wrap to a negative upper bound
+    const long intMax = std::numeric_limits<int>::max();
+    std::mt19937 rng(m_seed ? *m_seed : std::random_device{}());
+    std::uniform_int_distribution distX(m_margin, static_cast<int>(std::min(m_width - m_margin, intMax)));
+    std::uniform_int_distribution distY(m_margin, static_cast<int>(std::min(m_height - m_margin, intMax)));
 
     for (int i = 0; i < m_count; ++i) {
         int x = distX(rng);
         int y = distY(rng);
-        points.push_back(Point{x, y});  // keep integers
+        points.push_back(Int32Point{x, y});
     }
 
     return points;
@@ -2,6 +2,7 @@
 #define RANDOMPOINTPROVIDER_H
 
 #include "IPointProvider.h"
+#include <optional>
 #include <random>
 
 class RandomPointProvider : public IPointProvider {
@@ -10,12 +11,19 @@ public:
     RandomPointProvider(int count, long width, long height, int margin = 50);
 
     std::vector<Point> getPoints() override;
+    // The generated integer coordinates themselves; getPoints() converts them to float,
+    // which rounds coordinates above 2^24. Same seed, same points.
+    std::vector<Int32Point> getIntegerPoints();
+
+    // Fixed seed for reproducible sets (benchmarks); unseeded providers use std::random_device
+    void setSeed(unsigned seed) { m_seed = seed; }
 
 private:
     int m_count;
     long m_width;
     long m_height;
     int m_margin;
+    std::optional<unsigned> m_seed;
 };
 
 #endif //RANDOMPOINTPROVIDER_H
@@ -18,6 +18,7 @@
 
 #include "algorithms/AndrewAlgorithm.h"
 #include "algorithms/QuickhullAlgorithm.h"
+#include "algorithms/FilteredAlgorithm.h"
 
 template <class F>
 long long time_ns(F&& f) {
@@ -61,8 +62,13 @@ void Protocol::run() {
 
     std::vector<int> sizes = {10, 100, 1000, 10000, 100000, 1000000};
 
-    std::cout << "Pattern | Number of Points | Time Andrew | Multiple Andrew | Time Quickhull | Multiple Quickhull" << std::endl;
-    std::cout << "---|---|---|---|---|---" << std::endl;
+    if (m_usePrefilter) {
+        std::cout << "Pattern | Number of Points | Time Andrew | Multiple Andrew | Time Quickhull | Multiple Quickhull | Culled" << std::endl;
+        std::cout << "---|---|---|---|---|---|---" << std::endl;
+    } else {
+        std::cout << "Pattern | Number of Points | Time Andrew | Multiple Andrew | Time Quickhull | Multiple Quickhull" << std::endl;
+        std::cout << "---|---|---|---|---|---" << std::endl;
+    }
 
     for (const auto& prov : providers) {
         long long prevA = 0;
@@ -84,16 +90,31 @@ void Protocol::run() {
                 continue;
             }
 
+            size_t culled = 0;
+
             long long nsA = time_ns([&](){
-                AndrewAlgorithm andrew(points);
-                volatile auto hullA = andrew.runCompleteAlgorithm(points);
-                (void)hullA;
+                if (m_usePrefilter) {
+                    FilteredAlgorithm andrew(std::make_unique<AndrewAlgorithm>(std::vector<Point>{}));
+                    volatile auto hullA = andrew.runCompleteAlgorithm(points);
+                    (void)hullA;
+                    culled = andrew.getCulledCount();
+                } else {
+                    AndrewAlgorithm andrew(points);
+                    volatile auto hullA = andrew.runCompleteAlgorithm(points);
+                    (void)hullA;
+                }
             });
 
             long long nsQ = time_ns([&](){
-                QuickHullAlgorithm quick(points);
-                volatile auto hullQ = quick.runCompleteAlgorithm(points);
-                (void)hullQ;
+                if (m_usePrefilter) {
+                    FilteredAlgorithm quick(std::make_unique<QuickHullAlgorithm>(std::vector<Point>{}));
+                    volatile auto hullQ = quick.runCompleteAlgorithm(points);
+                    (void)hullQ;
+                } else {
+                    QuickHullAlgorithm quick(points);
+                    volatile auto hullQ = quick.runCompleteAlgorithm(points);
+                    (void)hullQ;
+                }
             });
 
             std::string multA = first ? "NA"
@@ -107,7 +128,11 @@ void Protocol::run() {
                     << nsA << "ns | "
                     << multA << " | "
                     << nsQ << "ns | "
-                    << multQ << std::endl;
+                    << multQ;
+            if (m_usePrefilter) {
+                std::cout << " | " << culled;
+            }
+            std::cout << std::endl;
 
             prevA = nsA;
             prevQ = nsQ;
@@ -2,5 +2,9 @@
 
 class Protocol {
 public:
+    explicit Protocol(bool usePrefilter = false) : m_usePrefilter(usePrefilter) {}
     void run();
+
+private:
+    bool m_usePrefilter;
 };
@@ -0,0 +1,42 @@
+#include "ChunkedPointReader.h"
+#include "point_providers/PointTextParser.h"
+
+ChunkedPointReader::ChunkedPointReader(const std::string& filename, size_t chunkSize)
+    : m_file(filename), m_chunkSize(chunkSize == 0 ? 1 : chunkSize),
+      m_declared(0), m_linesRead(0), m_pointsRead(0), m_malformedLines(0) {
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    long n = 0;
+    m_file >> n;
+    m_declared = n > 0 ? static_cast<size_t>(n) : 0;
+    std::getline(m_file, m_line);
+}
+
+bool ChunkedPointReader::next(std::vector<Point>& chunk) {
+    chunk.clear();
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    // Same line format and limits as FromFilePointProvider: at most the declared
+    // number of lines, lines that do not parse are counted and skipped
+    while (chunk.size() < m_chunkSize && m_linesRead < m_declared) {
+        if (!std::getline(m_file, m_line)) {
+            m_declared = m_linesRead;
+            break;
+        }
+        m_linesRead++;
+
+        Point p;
+        if (PointTextParser::parseLine(m_line.data(), m_line.data() + m_line.size(), p)) {
+            chunk.push_back(p);
+        } else {
+            m_malformedLines++;
+        }
+    }
+
+    m_pointsRead += chunk.size();
+    return !chunk.empty();
+}
@@ -0,0 +1,36 @@
+#ifndef CHUNKEDPOINTREADER_H
+#define CHUNKEDPOINTREADER_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "point_providers/Point.h"
+
+// Reads a point file (count line followed by "x,y" lines) in chunks of at most
+// chunkSize points, so the whole file never has to be held in memory
+class ChunkedPointReader {
+public:
+    ChunkedPointReader(const std::string& filename, size_t chunkSize);
+
+    bool isOpen() const { return m_file.is_open(); }
+
+    // Replaces the contents of chunk with the next points; returns false at the end of input
+    bool next(std::vector<Point>& chunk);
+
+    size_t getChunkSize() const { return m_chunkSize; }
+    size_t getPointsRead() const { return m_pointsRead; }
+    // Number of points announced by the header line
+    size_t getDeclaredCount() const { return m_declared; }
+    size_t getMalformedLineCount() const { return m_malformedLines; }
+
+private:
+    std::ifstream m_file;
+    std::string m_line;
+    size_t m_chunkSize;
+    size_t m_declared;
+    size_t m_linesRead;
+    size_t m_pointsRead;
+    size_t m_malformedLines;
+};
+
+#endif //CHUNKEDPOINTREADER_H
@@ -0,0 +1,46 @@
+#include "StreamingHull.h"
+#include "ChunkedPointReader.h"
+#include "algorithms/AndrewAlgorithm.h"
+#include <algorithm>
+
+void StreamingHull::addChunk(const std::vector<Point>& chunk) {
+    if (chunk.empty()) {
+        return;
+    }
+
+    // Only hull vertices of earlier chunks can still be on the final hull
+    m_buffer.clear();
+    m_buffer.reserve(m_hull.size() + chunk.size());
+    m_buffer.insert(m_buffer.end(), m_hull.begin(), m_hull.end());
+    m_buffer.insert(m_buffer.end(), chunk.begin(), chunk.end());
+    m_peakPoints = std::max(m_peakPoints, m_buffer.size());
+
+    AndrewAlgorithm andrew({});
+    m_hull = andrew.runCompleteAlgorithm(m_buffer);
+
+    m_pointCount += chunk.size();
+    m_chunkCount++;
+}
+
+void StreamingHull::clear() {
+    m_hull.clear();
+    m_buffer.clear();
+    m_pointCount = 0;
+    m_chunkCount = 0;
+    m_peakPoints = 0;
+}
+
+bool StreamingHull::fromFile(const std::string& filename, size_t chunkSize, StreamingHull& out) {
+    ChunkedPointReader reader(filename, chunkSize);
+    if (!reader.isOpen()) {
+        return false;
+    }
+
+    out.clear();
+    std::vector<Point> chunk;
+    chunk.reserve(reader.getChunkSize());
+    while (reader.next(chunk)) {
+        out.addChunk(chunk);
+    }
+    return true;
+}
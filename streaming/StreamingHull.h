@@ -0,0 +1,36 @@
+#ifndef STREAMINGHULL_H
+#define STREAMINGHULL_H
+
+#include <string>
+#include <vector>
+#include "point_providers/Point.h"
+
+// Out-of-core convex hull: points arrive in chunks and only the running hull is kept.
+// Each chunk is merged by computing the hull of (running hull + chunk) with Andrew's
+// algorithm, so memory stays at O(chunk + h) no matter how large the input is.
+class StreamingHull {
+public:
+    StreamingHull() = default;
+
+    void addChunk(const std::vector<Point>& chunk);
+    void clear();
+
+    // Counterclockwise hull of everything added so far, starting at the smallest point
+    const std::vector<Point>& getHull() const { return m_hull; }
+    size_t getPointCount() const { return m_pointCount; }
+    size_t getChunkCount() const { return m_chunkCount; }
+    // Largest number of points held at once (running hull + chunk)
+    size_t getPeakPoints() const { return m_peakPoints; }
+
+    // Streams a point file through a StreamingHull; returns false if the file cannot be opened
+    static bool fromFile(const std::string& filename, size_t chunkSize, StreamingHull& out);
+
+private:
+    std::vector<Point> m_hull;
+    std::vector<Point> m_buffer;
+    size_t m_pointCount = 0;
+    size_t m_chunkCount = 0;
+    size_t m_peakPoints = 0;
+};
+
+#endif //STREAMINGHULL_H
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "algorithms/AndrewAlgorithm.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
 
 static std::vector<Point> runAndrew(const std::vector<Point>& pts) {
     AndrewAlgorithm alg(pts);
@@ -27,3 +29,26 @@ TEST(AndrewEdgeCases, AllCollinear) {
     for (auto&p: hull) { if (p.x == -1 && p.y == 0) hasMin = true; if (p.x == 2 && p.y == 0) hasMax = true; }
     EXPECT_TRUE(hasMin && hasMax);
 }
+
+TEST(AndrewParallel, MatchesSerial) {
+    // Integer coordinates in a small window keep the float predicate exact and produce many duplicates
+    RandomPointProvider prov(100000, 1200, 800);
+    auto pts = prov.getPoints();
+
+    AndrewAlgorithm alg(pts);
+    alg.setThreadCount(4);
+    ASSERT_EQ(runAndrew(pts), alg.runCompleteAlgorithm(pts));
+    ASSERT_TRUE(alg.isFinished());
+}
+
+TEST(AndrewParallel, BlockMergeMatchesSerial) {
+    RandomPointProvider random(600000, 1200, 800);
+    auto pts = random.getPoints();
+    SquarePointProvider square(300000, 1200, 800);
+    auto squarePts = square.getPoints();
+    pts.insert(pts.end(), squarePts.begin(), squarePts.end());
+
+    AndrewAlgorithm alg(pts);
+    alg.setThreadCount(5);
+    ASSERT_EQ(runAndrew(pts), alg.runCompleteAlgorithm(pts));
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/BatchHull.h"
+
+static std::vector<Point> andrewHull(const std::vector<Point>& pts) {
+    return AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+}
+
+// Sets of 0..maxSize points; small coordinate ranges give duplicates and collinear points
+static void makeBatch(unsigned seed, size_t sets, size_t maxSize,
+                      std::vector<Point>& points, std::vector<size_t>& offsets) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> size(0, maxSize);
+    std::uniform_int_distribution<int> range(0, 3);
+    points.clear();
+    offsets.assign(1, 0);
+    for (size_t s = 0; s < sets; s++) {
+        const int extent = (range(rng) == 0) ? 3 : 1000;
+        std::uniform_int_distribution<int> coord(-extent, extent);
+        const size_t n = size(rng);
+        for (size_t i = 0; i < n; i++) points.push_back({coord(rng), coord(rng)});
+        offsets.push_back(points.size());
+    }
+}
+
+static void expectMatchesAndrew(const std::vector<Point>& points, const std::vector<size_t>& offsets,
+                                const BatchHull::Output& out) {
+    ASSERT_EQ(out.size(), offsets.size() - 1);
+    for (size_t i = 0; i < out.size(); i++) {
+        const std::vector<Point> set(points.begin() + offsets[i], points.begin() + offsets[i + 1]);
+        const auto hull = out.hull(i);
+        ASSERT_EQ(std::vector<Point>(hull.begin(), hull.end()), andrewHull(set)) << "set " << i;
+    }
+}
+
+TEST(BatchHull, MatchesAndrewPerSet) {
+    std::vector<Point> points;
+    std::vector<size_t> offsets;
+    makeBatch(3, 2000, 500, points, offsets);
+
+    BatchHull batch;
+    BatchHull::Output out;
+    ASSERT_TRUE(batch.compute(points, offsets, out));
+    expectMatchesAndrew(points, offsets, out);
+}
+
+TEST(BatchHull, ParallelMatchesSerial) {
+    std::vector<Point> points;
+    std::vector<size_t> offsets;
+    makeBatch(5, 5000, 120, points, offsets);
+
+    BatchHull serial;
+    BatchHull parallel;
+    parallel.setThreadCount(4);
+    EXPECT_EQ(parallel.getThreadCount(), 4);
+
+    BatchHull::Output a;
+    BatchHull::Output b;
+    ASSERT_TRUE(serial.compute(points, offsets, a));
+    ASSERT_TRUE(parallel.compute(points, offsets, b));
+    EXPECT_EQ(a.points, b.points);
+    EXPECT_EQ(a.offsets, b.offsets);
+}
+
+TEST(BatchHull, ReusesOutputAndHonoursFirstOffset) {
+    std::vector<Point> points;
+    std::vector<size_t> offsets;
+    makeBatch(7, 300, 50, points, offsets);
+
+    BatchHull batch;
+    BatchHull::Output out;
+    ASSERT_TRUE(batch.compute(points, offsets, out));
+
+    // A sub-batch that does not start at the beginning of the buffer
+    const std::vector<size_t> tail(offsets.begin() + 100, offsets.end());
+    ASSERT_TRUE(batch.compute(points, tail, out));
+    EXPECT_EQ(out.offsets.front(), 0);
+    for (size_t i = 0; i < out.size(); i++) {
+        const std::vector<Point> set(points.begin() + tail[i], points.begin() + tail[i + 1]);
+        const auto hull = out.hull(i);
+        EXPECT_EQ(std::vector<Point>(hull.begin(), hull.end()), andrewHull(set));
+    }
+}
+
+TEST(BatchHull, RejectsInvalidOffsets) {
+    const std::vector<Point> points{{0, 0}, {1, 0}, {0, 1}};
+    BatchHull batch;
+    BatchHull::Output out;
+
+    EXPECT_FALSE(batch.compute(points, std::vector<size_t>{0, 2, 1}, out));
+    EXPECT_FALSE(batch.compute(points, std::vector<size_t>{0, 4}, out));
+    EXPECT_EQ(out.size(), 0);
+
+    EXPECT_TRUE(batch.compute(points, std::vector<size_t>{}, out));
+    EXPECT_EQ(out.size(), 0);
+    EXPECT_TRUE(batch.compute(points, std::vector<size_t>{0, 0, 3}, out));
+    EXPECT_EQ(out.size(), 2);
+    EXPECT_TRUE(out.hull(0).empty());
+    EXPECT_EQ(out.hull(1).size(), 3);
+}
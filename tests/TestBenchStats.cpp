@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+#include "bench/BenchStats.h"
+
+TEST(BenchStats, SummarizesSamples) {
+    auto s = BenchStats::fromSamples({5, 1, 4, 2, 3});
+    EXPECT_EQ(s.runs, 5);
+    EXPECT_DOUBLE_EQ(s.min, 1);
+    EXPECT_DOUBLE_EQ(s.max, 5);
+    EXPECT_DOUBLE_EQ(s.mean, 3);
+    EXPECT_DOUBLE_EQ(s.median, 3);
+    EXPECT_DOUBLE_EQ(s.p95, 4.8);
+    EXPECT_NEAR(s.stddev, 1.5811388, 1e-6);
+}
+
+TEST(BenchStats, EvenCountAndSingleSample) {
+    EXPECT_DOUBLE_EQ(BenchStats::fromSamples({4, 1, 3, 2}).median, 2.5);
+
+    auto one = BenchStats::fromSamples({7});
+    EXPECT_DOUBLE_EQ(one.median, 7);
+    EXPECT_DOUBLE_EQ(one.p95, 7);
+    EXPECT_DOUBLE_EQ(one.stddev, 0);
+
+    EXPECT_EQ(BenchStats::fromSamples({}).runs, 0);
+}
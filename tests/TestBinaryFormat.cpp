@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/BinaryPointFormat.h"
+#include "point_providers/FromFilePointProvider.h"
+#include "point_providers/MappedPointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+
+TEST(BinaryFormat, RoundTripIsZeroCopy) {
+    auto pts = RandomPointProvider(10000, LONG_MAX, LONG_MAX).getPoints();
+    ASSERT_TRUE(writeBinaryPoints("roundtrip.bin", pts));
+
+    {
+        MappedPointProvider provider("roundtrip.bin");
+        ASSERT_TRUE(provider.isValid());
+        ASSERT_TRUE(provider.hasBounds());
+        EXPECT_EQ(provider.getHeader().count, pts.size());
+
+        const auto span = provider.getSpan();
+        ASSERT_EQ(span.size(), pts.size());
+        EXPECT_TRUE(std::equal(span.begin(), span.end(), pts.begin()));
+        EXPECT_EQ(provider.getPoints(), pts);
+
+        for (const auto& p : span) {
+            EXPECT_GE(p.x, provider.getHeader().minX);
+            EXPECT_LE(p.y, provider.getHeader().maxY);
+        }
+
+        // Both algorithms accept the mapped span directly
+        auto expected = AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+        EXPECT_EQ(AndrewAlgorithm({}).runCompleteAlgorithm(span), expected);
+        EXPECT_EQ(QuickHullAlgorithm({}).runCompleteAlgorithm(span),
+                  QuickHullAlgorithm(pts).runCompleteAlgorithm(pts));
+    }
+    std::remove("roundtrip.bin");
+}
+
+TEST(BinaryFormat, ConvertsTextFiles) {
+    std::ifstream test("../../point_files/random.txt");
+    if (!test.good()) GTEST_SKIP();
+
+    auto pts = FromFilePointProvider("../../point_files/random.txt").getPoints();
+    ASSERT_TRUE(writeBinaryPoints("random.bin", pts));
+    EXPECT_EQ(MappedPointProvider("random.bin").getPoints(), pts);
+    std::remove("random.bin");
+}
+
+TEST(BinaryFormat, ReadsFloat64) {
+    BinaryPointHeader header{};
+    std::memcpy(header.magic, "CHPT", 4);
+    header.version = BINARY_POINT_VERSION;
+    header.coordinateType = static_cast<uint32_t>(CoordinateType::FLOAT64);
+    header.count = 2;
+
+    char block[BINARY_POINT_DATA_OFFSET] = {};
+    std::memcpy(block, &header, sizeof(header));
+    const double coords[] = {1.5, 2.5, -3.0, 4.0};
+    {
+        std::ofstream file("doubles.bin", std::ios::binary);
+        file.write(block, sizeof(block));
+        file.write(reinterpret_cast<const char*>(coords), sizeof(coords));
+    }
+
+    MappedPointProvider provider("doubles.bin");
+    ASSERT_TRUE(provider.isValid());
+    EXPECT_FALSE(provider.hasBounds());
+    EXPECT_EQ(provider.getPoints(), (std::vector<Point>{{1.5f, 2.5f}, {-3.0f, 4.0f}}));
+    std::remove("doubles.bin");
+}
+
+TEST(BinaryFormat, RejectsInvalidFiles) {
+    EXPECT_FALSE(MappedPointProvider("does_not_exist.bin").isValid());
+
+    {
+        std::ofstream file("text.bin");
+        file << "3\n1,2\n3,4\n5,6\n";
+    }
+    EXPECT_FALSE(MappedPointProvider("text.bin").isValid());
+    std::remove("text.bin");
+
+    // Header announces more points than the file holds
+    std::vector<Point> pts{{1, 2}, {3, 4}, {5, 6}};
+    ASSERT_TRUE(writeBinaryPoints("truncated.bin", pts));
+    {
+        std::ifstream in("truncated.bin", std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out("truncated.bin", std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 4));
+    }
+    MappedPointProvider truncated("truncated.bin");
+    EXPECT_FALSE(truncated.isValid());
+    EXPECT_TRUE(truncated.getPoints().empty());
+    std::remove("truncated.bin");
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/ChanAlgorithm.h"
+#include "algorithms/Orientation.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/LinePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+static std::vector<Point> runChan(const std::vector<Point>& pts, unsigned threads = 1) {
+    ChanAlgorithm alg(pts);
+    alg.setThreadCount(threads);
+    return alg.runCompleteAlgorithm(pts);
+}
+
+static std::vector<Point> runAndrew(const std::vector<Point>& pts) {
+    AndrewAlgorithm alg(pts);
+    return alg.runCompleteAlgorithm(pts);
+}
+
+TEST(ChanBasics, Triangle) {
+    std::vector<Point> pts{{0,0},{1,0},{0,1},{0.2f,0.2f}};
+    ASSERT_EQ(runChan(pts).size(), 3);
+}
+
+TEST(ChanBasics, DuplicatesAndCollinear) {
+    std::vector<Point> pts{{0,0},{2,0},{2,2},{0,2},{1,0},{1,2},{0,0},{2,2},{1,1},{0,1}};
+    ASSERT_EQ(runAndrew(pts), runChan(pts));
+}
+
+TEST(ChanBasics, AllCollinear) {
+    std::vector<Point> pts{{0,0},{1,0},{2,0},{-1,0},{3,0},{1,0}};
+    ASSERT_EQ(runAndrew(pts), runChan(pts));
+}
+
+TEST(ChanMatchesAndrew, Providers) {
+    RandomPointProvider random(20000, 1200, 800);
+    RandomPointProvider randomWide(20000, LONG_MAX, LONG_MAX);
+    CirclePointProvider circle(2000, 1200, 800);
+    SquarePointProvider square(5000, 1200, 800);
+    LinePointProvider line(1000, 1200, 800);
+
+    for (auto pts : {random.getPoints(), randomWide.getPoints(), circle.getPoints(),
+                     square.getPoints(), line.getPoints()}) {
+        ASSERT_EQ(runAndrew(pts), runChan(pts));
+        ASSERT_EQ(runAndrew(pts), runChan(pts, 3));
+    }
+}
+
+TEST(ChanTangent, BinarySearchMatchesLinearScan) {
+    CirclePointProvider circle(64, 1200, 800);
+    auto pts = circle.getPoints();
+    auto hull = runAndrew(pts);
+
+    const std::vector<Point> queries{{2000, 400}, {-500, 10}, {600, -900}, {600, 2000}, {1500, 1500}};
+    for (const auto& p : queries) {
+        const size_t q = ChanAlgorithm::tangent(hull, p);
+        ASSERT_LT(q, hull.size());
+        for (const auto& r : hull) {
+            const float c = (hull[q].x - p.x) * (r.y - p.y) - (hull[q].y - p.y) * (r.x - p.x);
+            EXPECT_GE(c, 0.0f);
+        }
+    }
+}
+
+// tangent() has no fallback, so it must find the vertex on its own: outside points, points
+// on the vertices and edges of the polygon, and points in line with an edge
+TEST(ChanTangent, BinarySearchFindsTangentOnRandomPolygons) {
+    std::mt19937 rng(29);
+    size_t queries = 0;
+    for (int t = 0; t < 2000; t++) {
+        const int range = t % 2 ? 20 : 100000;
+        std::uniform_int_distribution<int> coord(-range, range);
+        std::uniform_int_distribution<int> outside(-3 * range, 3 * range);
+        std::vector<Point> pts(3 + rng() % 300);
+        for (auto& p : pts) {
+            p = {static_cast<float>(coord(rng)), static_cast<float>(coord(rng))};
+        }
+        const auto hull = runAndrew(pts);
+        const size_t k = hull.size();
+        if (k < 3) continue;
+
+        for (int i = 0; i < 20; i++) {
+            const Point& a = hull[rng() % k];
+            const Point& b = hull[(&a - hull.data() + 1) % k];
+            Point p;
+            switch (i % 5) {
+                case 0: p = {static_cast<float>(outside(rng)), static_cast<float>(outside(rng))}; break;
+                case 1: p = a; break;
+                case 2: p = {(a.x + b.x) / 2, (a.y + b.y) / 2}; break;
+                case 3: p = {2 * b.x - a.x, 2 * b.y - a.y}; break;
+                default: p = {2 * a.x - b.x, 2 * a.y - b.y}; break;
+            }
+            bool inside = true;
+            for (size_t j = 0; j < k; j++) {
+                inside = inside && Orientation::sign(hull[j], hull[(j + 1) % k], p) > 0;
+            }
+            if (inside) continue;
+
+            const size_t q = ChanAlgorithm::tangent(hull, p);
+            ASSERT_LT(q, k);
+            ASSERT_NE(hull[q], p);
+            for (const auto& r : hull) {
+                ASSERT_GE(Orientation::sign(p, hull[q], r), 0) << t << " " << i;
+            }
+            ASSERT_EQ(q, ChanAlgorithm::linearTangent(hull, p)) << t << " " << i;
+            queries++;
+        }
+    }
+    EXPECT_GT(queries, 20000);
+}
+
+TEST(ChanStepMode, ProducesHullStepwise) {
+    RandomPointProvider random(500, 1200, 800);
+    auto pts = random.getPoints();
+
+    ChanAlgorithm alg(pts);
+    int steps = 0;
+    while (alg.step()) {
+        ++steps;
+    }
+    EXPECT_TRUE(alg.isFinished());
+    EXPECT_GT(steps, 1);
+    EXPECT_EQ(runAndrew(pts), alg.getCurrentHull());
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/Orientation.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/RandomPointProvider.h"
+
+static_assert(std::is_same_v<CrossType<float>, float>);
+static_assert(std::is_same_v<CrossType<double>, double>);
+
+// Both algorithms return the same vertex set, and it is strictly convex with every input
+// point inside or on it
+template <class T>
+static void expectSameHull(const std::vector<BasicPoint<T>>& pts) {
+    auto a = BasicAndrewAlgorithm<T>(pts).runCompleteAlgorithm(pts);
+    auto q = BasicQuickHullAlgorithm<T>(pts).runCompleteAlgorithm(pts);
+
+    ASSERT_GE(a.size(), 3);
+    for (size_t i = 0; i < a.size(); i++) {
+        const auto& p0 = a[i];
+        const auto& p1 = a[(i + 1) % a.size()];
+        ASSERT_EQ(Orientation::sign(p0, p1, a[(i + 2) % a.size()]), 1) << i;
+        for (const auto& p : pts) {
+            ASSERT_GE(Orientation::sign(p0, p1, p), 0);
+        }
+    }
+
+    std::sort(a.begin(), a.end());
+    std::sort(q.begin(), q.end());
+    EXPECT_EQ(a, q);
+}
+
+TEST(CoordinateTypes, IntegerPointsMatchFloatPoints) {
+    RandomPointProvider prov(1000, 1200, 800);
+    prov.setSeed(7);
+    const auto integers = prov.getIntegerPoints();
+    const auto floats = prov.getPoints();
+
+    ASSERT_EQ(integers.size(), floats.size());
+    for (size_t i = 0; i < integers.size(); i++) {
+        EXPECT_EQ(static_cast<float>(integers[i].x), floats[i].x);
+        EXPECT_EQ(static_cast<float>(integers[i].y), floats[i].y);
+    }
+}
+
+TEST(CoordinateTypes, DoubleHullsAgree) {
+    // Near-collinear points around y = x, a few ulps off the diagonal
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coord(1.0e15, 2.0e15);
+    std::uniform_int_distribution<int> ulps(-3, 3);
+    std::vector<DoublePoint> pts;
+    for (int i = 0; i < 5000; i++) {
+        const double x = coord(rng);
+        const double y = x + ulps(rng) * 0.25;
+        pts.push_back({x, y});
+    }
+    pts.push_back({0.9e15, 0.9e15});
+    pts.push_back({2.1e15, 2.1e15});
+
+    expectSameHull(pts);
+}
+
+#ifdef __SIZEOF_INT128__
+static_assert(std::is_same_v<CrossType<std::int32_t>, __int128>);
+static_assert(std::is_same_v<CrossType<std::int64_t>, WideCross>);
+
+TEST(CoordinateTypes, Int32CrossIsExactOverTheFullRange) {
+    // The coordinate differences need 33 bits and their products 66
+    const Int32Point o{INT_MIN, INT_MIN};
+    const Int32Point a{INT_MAX, INT_MAX};
+
+    EXPECT_EQ(Orientation::sign(o, a, Int32Point{0, 0}), 0);
+    EXPECT_EQ(Orientation::sign(o, a, Int32Point{0, 1}), 1);
+    EXPECT_EQ(Orientation::sign(o, a, Int32Point{1, 0}), -1);
+    EXPECT_EQ(Orientation::sign(o, a, Int32Point{INT_MAX - 1, INT_MAX}), 1);
+
+    // The float predicate cannot tell these apart: both points round to the same coordinates
+    EXPECT_EQ(Orientation::sign(Point{o.x, o.y}, Point{a.x, a.y}, Point{INT_MAX - 1, INT_MAX}), 0);
+}
+
+TEST(CoordinateTypes, Int64CrossIsExactOverTheFullRange) {
+    // The coordinate differences need 65 bits and their products 130
+    const Int64Point o{INT64_MIN, INT64_MIN};
+    const Int64Point a{INT64_MAX, INT64_MAX};
+
+    EXPECT_EQ(Orientation::sign(o, a, Int64Point{0, 0}), 0);
+    EXPECT_EQ(Orientation::sign(o, a, Int64Point{0, 1}), 1);
+    EXPECT_EQ(Orientation::sign(o, a, Int64Point{1, 0}), -1);
+    EXPECT_EQ(Orientation::sign(o, a, Int64Point{INT64_MAX - 1, INT64_MAX}), 1);
+    EXPECT_EQ(Orientation::sign(a, o, Int64Point{INT64_MAX - 1, INT64_MAX}), -1);
+
+    // (2^63 - 1)^2 = (2^62 - 1) * 2^64 + 1
+    const std::int64_t zero = 0;
+    const WideCross square = Orientation::cross(Int64Point{zero, zero}, Int64Point{INT64_MAX, zero}, Int64Point{zero, INT64_MAX});
+    EXPECT_EQ(square, WideCross((__int128{1} << 62) - 1, 1));
+    EXPECT_EQ(-square, WideCross(-(__int128{1} << 62), ~std::uint64_t{0}));
+    EXPECT_LT(-square, WideCross(0));
+    EXPECT_GT(square, WideCross(__int128{1} << 125));
+
+    // The split product agrees with plain 128-bit arithmetic wherever that one is exact
+    std::mt19937_64 rng(19);
+    std::uniform_int_distribution<std::int64_t> diff(-(std::int64_t{1} << 61), std::int64_t{1} << 61);
+    for (int i = 0; i < 1000; i++) {
+        const __int128 ax = diff(rng), ay = diff(rng), bx = diff(rng), by = diff(rng);
+        ASSERT_EQ(Orientation::wideCross(ax, ay, bx, by), WideCross(ax * by - ay * bx)) << i;
+    }
+}
+
+TEST(CoordinateTypes, Int64HullsAtTheLimits) {
+    std::mt19937_64 rng(23);
+    std::uniform_int_distribution<std::int64_t> coord(INT64_MIN, INT64_MAX);
+    std::vector<Int64Point> pts;
+    for (int i = 0; i < 3000; i++) {
+        pts.push_back({coord(rng), coord(rng)});
+    }
+    for (int k = -4; k <= 4; k++) {
+        const std::int64_t v = k * (INT64_MAX / 4);
+        pts.push_back({v, INT64_MIN});
+        pts.push_back({INT64_MAX, v});
+    }
+    pts.push_back({INT64_MIN, INT64_MIN});
+    pts.push_back({INT64_MAX, INT64_MAX});
+
+    expectSameHull(pts);
+}
+
+TEST(CoordinateTypes, Int32HullsAgree) {
+    RandomPointProvider prov(20000, LONG_MAX, LONG_MAX, 0);
+    prov.setSeed(11);
+    auto pts = prov.getIntegerPoints();
+
+    // Collinear points on the edges of a bounding square, including its corners
+    for (int k = -4; k <= 4; k++) {
+        const int v = k * (INT_MAX / 4);
+        pts.push_back({v, INT_MIN});
+        pts.push_back({v, INT_MAX});
+        pts.push_back({INT_MIN, v});
+        pts.push_back({INT_MAX, v});
+    }
+    pts.push_back({INT_MIN, INT_MIN});
+    pts.push_back({INT_MAX, INT_MAX});
+    pts.push_back({INT_MIN, INT_MAX});
+    pts.push_back({INT_MAX, INT_MIN});
+
+    expectSameHull(pts);
+
+    EXPECT_EQ(BasicAndrewAlgorithm<std::int32_t>(pts).runCompleteAlgorithm(pts).size(), 4);
+}
+
+TEST(CoordinateTypes, Int64NearCollinearHull) {
+    // A line of slope 3/5 at magnitude 2^61, with points exactly on it and one unit off.
+    // None of these coordinates survive a conversion to double.
+    const std::int64_t base = std::int64_t{1} << 61;
+    const Int64Point start{-base + 1, -base + 3};
+    std::vector<Int64Point> pts{start};
+
+    std::mt19937_64 rng(13);
+    std::uniform_int_distribution<std::int64_t> step(1, (base / 5) * 2 - 1);
+    std::uniform_int_distribution<int> off(-1, 1);
+    for (int i = 0; i < 2000; i++) {
+        const std::int64_t k = step(rng);
+        pts.push_back({start.x + 5 * k, start.y + 3 * k + off(rng)});
+    }
+    const std::int64_t last = (base / 5) * 2;
+    pts.push_back({start.x + 5 * last, start.y + 3 * last});
+
+    const Int64Point end = pts.back();
+    for (const auto& p : pts) {
+        const int s = Orientation::sign(start, end, p);
+        const std::int64_t expected = p.y - (start.y + (p.x - start.x) / 5 * 3);
+        EXPECT_EQ(s, (expected > 0) - (expected < 0));
+    }
+
+    expectSameHull(pts);
+}
+
+TEST(CoordinateTypes, SteppedInt64HullMatchesComplete) {
+    std::mt19937_64 rng(17);
+    std::uniform_int_distribution<std::int64_t> coord(-(std::int64_t{1} << 60), std::int64_t{1} << 60);
+    std::vector<Int64Point> pts;
+    for (int i = 0; i < 3000; i++) {
+        pts.push_back({coord(rng), coord(rng)});
+    }
+
+    BasicQuickHullAlgorithm<std::int64_t> quickHull(pts);
+    BasicAndrewAlgorithm<std::int64_t> andrew(pts);
+    for (BasicIAlgorithm<std::int64_t>* alg : {static_cast<BasicIAlgorithm<std::int64_t>*>(&quickHull),
+                                               static_cast<BasicIAlgorithm<std::int64_t>*>(&andrew)}) {
+        while (alg->step()) {}
+        ASSERT_TRUE(alg->isFinished());
+        EXPECT_EQ(alg->getCurrentHull(), alg->runCompleteAlgorithm(pts));
+    }
+}
+#endif
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/DynamicHull.h"
+#include "point_providers/CirclePointProvider.h"
+
+static std::vector<Point> andrewHull(const std::vector<Point>& pts) {
+    return AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+}
+
+TEST(DynamicHull, SmallSets) {
+    DynamicHull hull;
+    EXPECT_TRUE(hull.hull().empty());
+
+    hull.insert({1, 1});
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{1, 1}}));
+
+    hull.insert({0, 0});
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{0, 0}, {1, 1}}));
+
+    hull.insert({2, 0});
+    hull.insert({1, 0});  // collinear on the bottom edge
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{0, 0}, {2, 0}, {1, 1}}));
+    EXPECT_EQ(hull.size(), 4);
+
+    EXPECT_TRUE(hull.erase({2, 0}));
+    EXPECT_FALSE(hull.erase({5, 5}));
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{0, 0}, {1, 0}, {1, 1}}));
+}
+
+TEST(DynamicHull, Duplicates) {
+    DynamicHull hull;
+    for (Point p : std::vector<Point>{{0, 0}, {4, 0}, {4, 4}, {0, 4}, {4, 4}, {2, 2}}) {
+        hull.insert(p);
+    }
+    EXPECT_TRUE(hull.erase({4, 4}));
+    EXPECT_TRUE(hull.contains({4, 4}));
+    EXPECT_EQ(hull.hull().size(), 4);
+
+    EXPECT_TRUE(hull.erase({4, 4}));
+    EXPECT_FALSE(hull.contains({4, 4}));
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{0, 0}, {4, 0}, {0, 4}}));
+}
+
+TEST(DynamicHull, VerticalAndCollinear) {
+    std::vector<Point> pts{{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}, {2, 1}, {3, 1}};
+    DynamicHull hull;
+    for (const auto& p : pts) hull.insert(p);
+    EXPECT_EQ(hull.hull(), andrewHull(pts));
+
+    std::vector<Point> line{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {-1, -1}};
+    DynamicHull lineHull;
+    for (const auto& p : line) lineHull.insert(p);
+    EXPECT_EQ(lineHull.hull(), andrewHull(line));
+}
+
+TEST(DynamicHull, RandomUpdatesMatchAndrew) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, 200);
+
+    for (int range : {10, 200}) {
+        DynamicHull hull;
+        std::vector<Point> pts;
+        for (int step = 0; step < 3000; step++) {
+            const bool remove = !pts.empty() && rng() % 3 == 0;
+            if (remove) {
+                const size_t i = rng() % pts.size();
+                ASSERT_TRUE(hull.erase(pts[i]));
+                pts[i] = pts.back();
+                pts.pop_back();
+            } else {
+                Point p{coord(rng) % (range + 1), coord(rng) % (range + 1)};
+                hull.insert(p);
+                pts.push_back(p);
+            }
+
+            ASSERT_EQ(hull.size(), pts.size());
+            // Andrew reports a single repeated point twice, skip tiny sets
+            if (step % 7 == 0 && pts.size() > 3) {
+                ASSERT_EQ(hull.hull(), andrewHull(pts)) << "step " << step;
+            }
+        }
+    }
+}
+
+TEST(DynamicHull, AllPointsOnHull) {
+    auto pts = CirclePointProvider(2000, 1200, 800).getPoints();
+    DynamicHull hull;
+    for (const auto& p : pts) hull.insert(p);
+    EXPECT_EQ(hull.hull(), andrewHull(pts));
+
+    // Drain every other point
+    std::vector<Point> rest;
+    for (size_t i = 0; i < pts.size(); i++) {
+        if (i % 2) ASSERT_TRUE(hull.erase(pts[i]));
+        else rest.push_back(pts[i]);
+    }
+    EXPECT_EQ(hull.hull(), andrewHull(rest));
+}
+
+TEST(DynamicHull, AssignMatchesInsertion) {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> coord(0, 50);
+    std::vector<Point> pts;
+    for (int i = 0; i < 2000; i++) pts.push_back({coord(rng), coord(rng)});
+
+    DynamicHull bulk(pts);
+    EXPECT_EQ(bulk.size(), pts.size());
+    EXPECT_EQ(bulk.hull(), andrewHull(pts));
+
+    // Updates keep working on a bulk-built structure
+    for (size_t i = 0; i < 1000; i++) ASSERT_TRUE(bulk.erase(pts[i]));
+    pts.erase(pts.begin(), pts.begin() + 1000);
+    EXPECT_EQ(bulk.hull(), andrewHull(pts));
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include "algorithms/AklToussaintFilter.h"
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/FilteredAlgorithm.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+static auto sortxy = [](const Point& A, const Point& B){ return A.x < B.x || (A.x == B.x && A.y < B.y);};
+
+TEST(AklToussaint, CullsInteriorOfRandomInput) {
+    RandomPointProvider prov(100000, LONG_MAX, LONG_MAX);
+    auto pts = prov.getPoints();
+
+    for (int directions : {4, 8}) {
+        AklToussaintFilter filter(directions);
+        auto kept = filter.apply(pts);
+
+        EXPECT_EQ(pts.size(), kept.size() + filter.getCulledCount());
+        EXPECT_GT(filter.getCulledCount(), 0);
+        if (directions == 8) {
+            // The octagon covers most of a uniform square
+            EXPECT_LT(kept.size(), pts.size() / 4);
+        }
+
+        auto full = AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+        auto filtered = AndrewAlgorithm(kept).runCompleteAlgorithm(kept);
+        ASSERT_EQ(full, filtered);
+    }
+}
+
+TEST(AklToussaint, KeepsBoundaryPoints) {
+    // Points on the polygon edges must survive, only (2,2) is strictly inside
+    std::vector<Point> pts{{2,0},{4,2},{2,4},{0,2},{1,1},{3,1},{2,2}};
+    AklToussaintFilter filter(4);
+    auto kept = filter.apply(pts);
+
+    EXPECT_EQ(1, filter.getCulledCount());
+    EXPECT_EQ(6, kept.size());
+}
+
+TEST(AklToussaint, DegenerateInputIsUntouched) {
+    std::vector<Point> line{{0,0},{1,1},{2,2},{3,3},{4,4}};
+    AklToussaintFilter filter;
+    EXPECT_EQ(line, filter.apply(line));
+    EXPECT_EQ(0, filter.getCulledCount());
+}
+
+TEST(FilteredAlgorithm, WrapsBothAlgorithms) {
+    CirclePointProvider circle(1000, 1200, 800);
+    SquarePointProvider square(1000, 1200, 800);
+    for (auto pts : {circle.getPoints(), square.getPoints()}) {
+        auto a = AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+        auto q = QuickHullAlgorithm(pts).runCompleteAlgorithm(pts);
+
+        FilteredAlgorithm fa(std::make_unique<AndrewAlgorithm>(pts));
+        FilteredAlgorithm fq(std::make_unique<QuickHullAlgorithm>(pts));
+        auto filteredA = fa.runCompleteAlgorithm(pts);
+        auto filteredQ = fq.runCompleteAlgorithm(pts);
+
+        std::sort(a.begin(), a.end(), sortxy);
+        std::sort(q.begin(), q.end(), sortxy);
+        std::sort(filteredA.begin(), filteredA.end(), sortxy);
+        std::sort(filteredQ.begin(), filteredQ.end(), sortxy);
+        ASSERT_EQ(a, filteredA);
+        ASSERT_EQ(q, filteredQ);
+    }
+}
+
+TEST(FilteredAlgorithm, StepModeRunsOnSurvivors) {
+    std::vector<Point> pts{{0,0},{4,0},{4,4},{0,4},{1,1},{2,2},{3,1}};
+    FilteredAlgorithm alg(std::make_unique<AndrewAlgorithm>(pts));
+    alg.reset(pts);
+    EXPECT_EQ(3, alg.getCulledCount());
+    while (alg.step()) {}
+    EXPECT_TRUE(alg.isFinished());
+    EXPECT_EQ(4, alg.getCurrentHull().size());
+}
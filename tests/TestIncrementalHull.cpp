@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/IncrementalHull.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+
+static std::vector<Point> andrewHull(const std::vector<Point>& pts) {
+    return AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+}
+
+TEST(IncrementalHull, RejectsInteriorPoints) {
+    IncrementalHull hull({{0, 0}, {10, 0}, {10, 10}, {0, 10}});
+    EXPECT_EQ(hull.getHullSize(), 4);
+
+    EXPECT_FALSE(hull.addPoint({5, 5}));
+    EXPECT_FALSE(hull.addPoint({10, 5}));  // on an edge
+    EXPECT_FALSE(hull.addPoint({0, 0}));   // a vertex
+    EXPECT_EQ(hull.getRejectedCount(), 3);
+
+    EXPECT_TRUE(hull.contains({1, 9}));
+    EXPECT_FALSE(hull.contains({11, 5}));
+    EXPECT_FALSE(hull.contains({-1, -1}));
+}
+
+TEST(IncrementalHull, SplicesExtremePoints) {
+    IncrementalHull hull({{0, 0}, {10, 0}, {10, 10}, {0, 10}});
+    EXPECT_TRUE(hull.addPoint({5, -5}));
+    EXPECT_TRUE(hull.addPoint({20, 20}));  // hides (10, 10)
+    EXPECT_EQ(hull.hull(), (std::vector<Point>{{0, 0}, {5, -5}, {10, 0}, {20, 20}, {0, 10}}));
+}
+
+TEST(IncrementalHull, BatchesMatchAndrew) {
+    std::mt19937 rng(11);
+    for (int range : {5, 1000}) {
+        std::uniform_int_distribution<int> coord(-range, range);
+        IncrementalHull hull;
+        std::vector<Point> all;
+
+        for (int batch = 0; batch < 50; batch++) {
+            std::vector<Point> pts;
+            for (int i = 0; i < 40; i++) pts.push_back({coord(rng), coord(rng)});
+            hull.addPoints(pts);
+            all.insert(all.end(), pts.begin(), pts.end());
+            ASSERT_EQ(hull.hull(), andrewHull(all)) << "batch " << batch;
+        }
+    }
+}
+
+TEST(IncrementalHull, ContinuesFromAlgorithmHull) {
+    auto pts = RandomPointProvider(5000, 1200, 800).getPoints();
+    QuickHullAlgorithm quick(pts);
+    while (quick.step()) {}
+
+    IncrementalHull hull(quick.getCurrentHull());
+    auto more = CirclePointProvider(300, 1200, 800).getPoints();
+    hull.addPoints(more);
+
+    pts.insert(pts.end(), more.begin(), more.end());
+    EXPECT_EQ(hull.hull(), andrewHull(pts));
+}
+
+TEST(IncrementalHull, DegenerateSets) {
+    std::vector<Point> line{{0, 0}, {2, 2}, {1, 1}, {-3, -3}};
+    EXPECT_EQ(IncrementalHull(line).hull(), andrewHull(line));
+
+    std::vector<Point> vertical{{1, 0}, {1, 5}, {1, 2}, {1, -4}};
+    EXPECT_EQ(IncrementalHull(vertical).hull(), andrewHull(vertical));
+
+    EXPECT_EQ(IncrementalHull({{3, 3}}).hull(), (std::vector<Point>{{3, 3}}));
+}
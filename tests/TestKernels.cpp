@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <cmath>
+#include "algorithms/Orientation.h"
+#include "algorithms/OrientationKernels.h"
+#include "point_providers/PointSoA.h"
+#include "point_providers/RandomPointProvider.h"
+
+static std::vector<OrientationKernels::Isa> supportedIsas() {
+    std::vector<OrientationKernels::Isa> isas{OrientationKernels::Isa::SCALAR};
+    const auto best = OrientationKernels::detectIsa();
+    if (best != OrientationKernels::Isa::SCALAR) isas.push_back(OrientationKernels::Isa::SSE2);
+    if (best == OrientationKernels::Isa::AVX2) isas.push_back(OrientationKernels::Isa::AVX2);
+    return isas;
+}
+
+static float scalarCross(const Point& o, const Point& a, const Point& b) {
+    return Orientation::cross(o, a, b);
+}
+
+TEST(OrientationKernels, AllIsasMatchScalarReference) {
+    // Odd size so every implementation also runs its scalar tail
+    RandomPointProvider prov(10007, LONG_MAX, LONG_MAX);
+    auto pts = prov.getPoints();
+    PointSoA soa(pts);
+    const Point a = pts[3];
+    const Point b = pts[11];
+
+    // Reference: the scalar loops the algorithms use
+    long refIdx = -1;
+    float refMax = 0.0f;
+    std::vector<Point> refLeft;
+    for (size_t i = 0; i < pts.size(); ++i) {
+        const float c = scalarCross(a, b, pts[i]);
+        if (c > 0) {
+            refLeft.push_back(pts[i]);
+            if (c > refMax) {
+                refMax = c;
+                refIdx = static_cast<long>(i);
+            }
+        }
+    }
+
+    for (auto isa : supportedIsas()) {
+        SCOPED_TRACE(OrientationKernels::isaName(isa));
+        OrientationKernels::setIsa(isa);
+
+        std::vector<float> dist(pts.size());
+        OrientationKernels::signedDistances(soa.x(), soa.y(), soa.size(), a, b, dist.data());
+        for (size_t i = 0; i < pts.size(); ++i) {
+            ASSERT_EQ(scalarCross(a, b, pts[i]), dist[i]);
+        }
+
+        auto farthest = OrientationKernels::argmaxDistance(soa.x(), soa.y(), soa.size(), a, b);
+        EXPECT_EQ(refIdx, farthest.index);
+        EXPECT_EQ(refMax, farthest.distance);
+
+        PointSoA left;
+        left.resize(soa.size());
+        size_t count = OrientationKernels::partitionBySide(soa.x(), soa.y(), soa.size(), a, b, left.x(), left.y());
+        left.resize(count);
+        EXPECT_EQ(refLeft, left.toPoints());
+    }
+    OrientationKernels::setIsa(OrientationKernels::detectIsa());
+}
+
+TEST(OrientationKernels, TiesResolveToLowestIndex) {
+    std::vector<Point> pts{{0,0},{1,5},{2,5},{3,5},{4,5},{5,5},{6,5},{7,5},{8,5},{9,5},{3,5}};
+    PointSoA soa(pts);
+
+    for (auto isa : supportedIsas()) {
+        SCOPED_TRACE(OrientationKernels::isaName(isa));
+        OrientationKernels::setIsa(isa);
+        auto farthest = OrientationKernels::argmaxDistance(soa.x(), soa.y(), soa.size(), Point{0,0}, Point{10,0});
+        EXPECT_EQ(1, farthest.index);
+
+        auto none = OrientationKernels::argmaxDistance(soa.x(), soa.y(), soa.size(), Point{10,0}, Point{0,0});
+        EXPECT_EQ(-1, none.index);
+    }
+    OrientationKernels::setIsa(OrientationKernels::detectIsa());
+}
+
+TEST(OrientationKernels, NearCollinearLanesMatchScalarReference) {
+    // Points within a few ulps of AB, where the float product and its sign are decided
+    // lane by lane, mixed with points well off the line
+    const Point a{-1000.0f, -1000.0f};
+    const Point b{1000.0f, 1000.0f};
+    std::vector<Point> pts;
+    for (int i = 0; i < 4003; ++i) {
+        const float t = -1000.0f + 0.5f * static_cast<float>(i);
+        const float off = (i % 5 == 0) ? static_cast<float>(i % 7) - 3.0f : 0.0f;
+        pts.push_back({t, std::nextafter(t, t + off)});
+    }
+    pts.push_back({a.x, 2000.0f});
+    pts.push_back({0.1f, 0.1f});
+    PointSoA soa(pts);
+    const auto extent = OrientationKernels::extentOf(soa.x(), soa.y(), soa.size());
+
+    std::vector<Point> refLeft;
+    for (const Point& p : pts) {
+        if (scalarCross(a, b, p) > 0) refLeft.push_back(p);
+    }
+
+    for (auto isa : supportedIsas()) {
+        SCOPED_TRACE(OrientationKernels::isaName(isa));
+        OrientationKernels::setIsa(isa);
+
+        std::vector<float> dist(pts.size());
+        OrientationKernels::signedDistances(soa.x(), soa.y(), soa.size(), a, b, extent, dist.data());
+        for (size_t i = 0; i < pts.size(); ++i) {
+            ASSERT_EQ(scalarCross(a, b, pts[i]), dist[i]);
+        }
+
+        PointSoA left;
+        left.resize(soa.size());
+        size_t count = OrientationKernels::partitionBySide(soa.x(), soa.y(), soa.size(), a, b, extent,
+                                                           left.x(), left.y());
+        left.resize(count);
+        EXPECT_EQ(refLeft, left.toPoints());
+    }
+    OrientationKernels::setIsa(OrientationKernels::detectIsa());
+}
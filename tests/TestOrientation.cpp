@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/Orientation.h"
+#include "algorithms/QuickhullAlgorithm.h"
+
+static float naiveCross(const Point& o, const Point& a, const Point& b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+static int signOf(double v) {
+    return (v > 0) - (v < 0);
+}
+
+// Coordinates in [2^20, 2^21): differences are exact in float (Sterbenz) and their
+// products exact in double, so the double determinant has the exact sign
+static int referenceSign(const Point& o, const Point& a, const Point& b) {
+    const double left = static_cast<double>(a.x - o.x) * static_cast<double>(b.y - o.y);
+    const double right = static_cast<double>(a.y - o.y) * static_cast<double>(b.x - o.x);
+    return signOf(left - right);
+}
+
+// Points close to the diagonal, a few ulps (1/8 at this magnitude) off it
+static std::vector<Point> nearDiagonal(unsigned seed, size_t n) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(1100000.0f, 2000000.0f);
+    std::uniform_int_distribution<int> ulps(-3, 3);
+    std::vector<Point> pts;
+    for (size_t i = 0; i < n; i++) {
+        const float x = coord(rng);
+        pts.push_back({x, x + 0.125f * static_cast<float>(ulps(rng))});
+    }
+    return pts;
+}
+
+TEST(Orientation, ExactSignNearCollinear) {
+    const auto pts = nearDiagonal(1, 3000);
+    size_t naiveWrong = 0;
+    for (size_t i = 0; i + 2 < pts.size(); i += 3) {
+        const Point& o = pts[i];
+        const Point& a = pts[i + 1];
+        const Point& b = pts[i + 2];
+        const int expected = referenceSign(o, a, b);
+
+        ASSERT_EQ(Orientation::sign(o, a, b), expected) << i;
+        ASSERT_EQ(signOf(Orientation::orient2d(o, a, b)), expected) << i;
+        naiveWrong += signOf(naiveCross(o, a, b)) != expected;
+    }
+    // The inputs are hard enough that plain float evaluation gets signs wrong
+    EXPECT_GT(naiveWrong, 0);
+}
+
+TEST(Orientation, ConsistentUnderPermutation) {
+    const auto pts = nearDiagonal(2, 3000);
+    for (size_t i = 0; i + 2 < pts.size(); i += 3) {
+        const Point& o = pts[i];
+        const Point& a = pts[i + 1];
+        const Point& b = pts[i + 2];
+        const int s = Orientation::sign(o, a, b);
+        ASSERT_EQ(Orientation::sign(a, b, o), s);
+        ASSERT_EQ(Orientation::sign(b, o, a), s);
+        ASSERT_EQ(Orientation::sign(o, b, a), -s);
+    }
+}
+
+TEST(Orientation, CertifiedResultsKeepFloatValue) {
+    const Point o{0, 0};
+    const Point a{10, 0};
+    const Point b{3, 7};
+    EXPECT_EQ(Orientation::cross(o, a, b), naiveCross(o, a, b));
+    EXPECT_EQ(Orientation::cross(o, a, b), 70.0f);
+    EXPECT_EQ(Orientation::orient2d(o, a, b), 70.0);
+    EXPECT_EQ(Orientation::cross(o, a, Point{20, 0}), 0.0f);
+}
+
+TEST(Orientation, HandlesOverflowingProducts) {
+    // The float products overflow, so the naive cross product is NaN
+    const Point o{-3e38f, -3e38f};
+    const Point a{0.0f, 0.0f};
+    const Point b{3e38f, 3e38f};
+    EXPECT_TRUE(std::isnan(naiveCross(o, a, b)));
+    EXPECT_EQ(Orientation::sign(o, a, b), 0);
+
+    const Point above{3e38f, std::nextafter(3e38f, std::numeric_limits<float>::infinity())};
+    EXPECT_EQ(Orientation::sign(o, a, above), 1);
+    EXPECT_EQ(Orientation::sign(o, above, a), -1);
+}
+
+TEST(Orientation, KeepsSignBelowFloatRange) {
+    const float tiny = std::numeric_limits<float>::denorm_min();
+    const Point o{0.0f, 0.0f};
+    const Point a{tiny, 0.0f};
+    const Point b{0.0f, tiny};
+    EXPECT_EQ(naiveCross(o, a, b), 0.0f);
+    EXPECT_GT(Orientation::cross(o, a, b), 0.0f);
+    EXPECT_LT(Orientation::cross(o, b, a), 0.0f);
+}
+
+TEST(Orientation, AlgorithmsAgreeOnNearCollinearInput) {
+    auto pts = nearDiagonal(3, 5000);
+    pts.push_back({1000000.0f, 1000000.0f});
+    pts.push_back({2100000.0f, 2100000.0f});
+
+    auto a = AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+    auto q = QuickHullAlgorithm(pts).runCompleteAlgorithm(pts);
+
+    // Strictly convex, and no input point outside
+    ASSERT_GE(a.size(), 3);
+    for (size_t i = 0; i < a.size(); i++) {
+        const Point& p0 = a[i];
+        const Point& p1 = a[(i + 1) % a.size()];
+        const Point& p2 = a[(i + 2) % a.size()];
+        ASSERT_EQ(Orientation::sign(p0, p1, p2), 1) << i;
+        for (const Point& p : pts) {
+            ASSERT_GE(Orientation::sign(p0, p1, p), 0);
+        }
+    }
+
+    std::sort(a.begin(), a.end());
+    std::sort(q.begin(), q.end());
+    EXPECT_EQ(a, q);
+}
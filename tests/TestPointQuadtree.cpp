@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <climits>
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/PointQuadtree.h"
+#include "point_providers/RandomPointProvider.h"
+
+static bool inside(const Point& p, const PointQuadtree::Rect& r) {
+    return p.x >= r.minX && p.x <= r.maxX && p.y >= r.minY && p.y <= r.maxY;
+}
+
+// The visited cells are disjoint, in order, non-empty, contain their points, and together
+// hold every point inside the view
+static std::vector<PointQuadtree::Cell> checkQuery(const std::vector<Point>& pts, const PointQuadtree& tree,
+                                                   const PointQuadtree::Rect& view, float minCellSize) {
+    std::vector<PointQuadtree::Cell> cells;
+    tree.query(view, minCellSize, [&](const PointQuadtree::Cell& cell) { cells.push_back(cell); });
+
+    std::vector<bool> covered(pts.size(), false);
+    size_t previousEnd = 0;
+    for (const auto& cell : cells) {
+        EXPECT_LT(cell.begin, cell.end);
+        EXPECT_GE(cell.begin, previousEnd);
+        previousEnd = cell.end;
+        EXPECT_TRUE(cell.depth == PointQuadtree::MAX_DEPTH || cell.bounds.maxX - cell.bounds.minX <= minCellSize);
+        for (size_t k = cell.begin; k < cell.end; k++) {
+            const std::uint32_t i = tree.order()[k];
+            EXPECT_TRUE(inside(pts[i], cell.bounds)) << i;
+            covered[i] = true;
+        }
+    }
+    for (size_t i = 0; i < pts.size(); i++) {
+        if (inside(pts[i], view)) {
+            EXPECT_TRUE(covered[i]) << i;
+        }
+    }
+    return cells;
+}
+
+TEST(PointQuadtree, OrderIsAPermutation) {
+    auto pts = RandomPointProvider(10000, 1200, 800).getPoints();
+    PointQuadtree tree(pts);
+    ASSERT_EQ(tree.size(), pts.size());
+    auto order = tree.order();
+    std::sort(order.begin(), order.end());
+    for (size_t i = 0; i < order.size(); i++) {
+        EXPECT_EQ(order[i], i);
+    }
+    EXPECT_EQ(tree.bounds().maxX - tree.bounds().minX, tree.bounds().maxY - tree.bounds().minY);
+}
+
+TEST(PointQuadtree, CoarseQueryReturnsTheRoot) {
+    auto pts = RandomPointProvider(5000, 1200, 800).getPoints();
+    PointQuadtree tree(pts);
+    auto cells = checkQuery(pts, tree, tree.bounds(), 1e30f);
+    ASSERT_EQ(cells.size(), 1);
+    EXPECT_EQ(cells[0].depth, 0);
+    EXPECT_EQ(cells[0].end - cells[0].begin, pts.size());
+}
+
+TEST(PointQuadtree, ViewQueriesCoverTheVisiblePoints) {
+    auto pts = RandomPointProvider(20000, 1200, 800).getPoints();
+    PointQuadtree tree(pts);
+    checkQuery(pts, tree, {100, 100, 400, 300}, 8);
+    checkQuery(pts, tree, {0, 0, 2000, 2000}, 50);
+    checkQuery(pts, tree, {600, 400, 601, 401}, 0);
+    EXPECT_TRUE(checkQuery(pts, tree, {-500, -500, -100, -100}, 1).empty());
+}
+
+TEST(PointQuadtree, CellCountFollowsTheViewNotThePoints) {
+    RandomPointProvider prov(1000000, LONG_MAX, LONG_MAX, 0);
+    auto pts = prov.getPoints();
+    PointQuadtree tree(pts);
+    const auto& b = tree.bounds();
+    const float size = b.maxX - b.minX;
+
+    // About 100 x 100 cells over the whole set, and over a corner of it at 16x zoom
+    const auto all = checkQuery(pts, tree, b, size / 100);
+    EXPECT_LE(all.size(), 128u * 128u);
+    const PointQuadtree::Rect corner{b.minX, b.minY, b.minX + size / 16, b.minY + size / 16};
+    const auto zoomed = checkQuery(pts, tree, corner, size / 1600);
+    EXPECT_LE(zoomed.size(), 130u * 130u);
+    EXPECT_GT(zoomed.size(), 1000u);
+}
+
+TEST(PointQuadtree, DegenerateInputs) {
+    EXPECT_EQ(PointQuadtree(std::vector<Point>{}).size(), 0);
+
+    std::vector<Point> same(100, Point{5, 5});
+    PointQuadtree tree(same);
+    auto cells = checkQuery(same, tree, {0, 0, 10, 10}, 0);
+    ASSERT_EQ(cells.size(), 1);
+    EXPECT_EQ(cells[0].end - cells[0].begin, same.size());
+
+    // Identical points, or a spread below float resolution at their magnitude, still give
+    // a bounding square of nonzero size
+    EXPECT_GT(tree.bounds().maxX, tree.bounds().minX);
+    EXPECT_GT(tree.bounds().maxY, tree.bounds().minY);
+    const std::vector<Point> far{{1e6f, 1e6f}, {1e6f, 1e6f + 0.0625f}, {1e6f, 1e6f}};
+    PointQuadtree farTree(far);
+    EXPECT_GT(farTree.bounds().maxX, farTree.bounds().minX);
+    checkQuery(far, farTree, {0, 0, 2e6f, 2e6f}, 0);
+
+    auto circle = CirclePointProvider(2000, 1200, 800).getPoints();
+    checkQuery(circle, PointQuadtree(circle), {0, 0, 1200, 800}, 4);
+}
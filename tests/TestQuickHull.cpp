@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include <algorithm>
+#include <climits>
 
 static std::vector<Point> runQuick(const std::vector<Point>& pts) {
     QuickHullAlgorithm alg(pts);
@@ -17,3 +21,99 @@ TEST(QuickHullBasics, RotatedSquare) {
     auto hull = runQuick(pts);
     ASSERT_EQ(hull.size(), 4);
 }
+
+TEST(QuickHullParallel, MatchesSerialOrdering) {
+    RandomPointProvider prov(200000, LONG_MAX, LONG_MAX);
+    auto pts = prov.getPoints();
+
+    auto serial = runQuick(pts);
+
+    QuickHullAlgorithm alg(pts);
+    alg.setThreadCount(4);
+    auto parallel = alg.runCompleteAlgorithm(pts);
+
+    ASSERT_EQ(serial, parallel);
+}
+
+TEST(QuickHullParallel, CircleMatchesSerialOrdering) {
+    CirclePointProvider prov(10000, LONG_MAX, LONG_MAX);
+    auto pts = prov.getPoints();
+
+    QuickHullAlgorithm alg(pts);
+    alg.setThreadCount(3);
+
+    ASSERT_EQ(runQuick(pts), alg.runCompleteAlgorithm(pts));
+}
+
+TEST(QuickHullInPlace, MatchesSerial) {
+    RandomPointProvider prov(50000, LONG_MAX, LONG_MAX);
+    auto pts = prov.getPoints();
+
+    ASSERT_EQ(runQuick(pts), QuickHullAlgorithm::runCompleteInPlace(pts));
+}
+
+TEST(QuickHullInPlace, CircleAndSquare) {
+    CirclePointProvider circle(1000, 1200, 800);
+    auto pts = circle.getPoints();
+    ASSERT_EQ(runQuick(pts), QuickHullAlgorithm::runCompleteInPlace(pts));
+
+    std::vector<Point> square{{0,0},{2,0},{2,2},{0,2},{1,0},{1,2},{1,1}};
+    ASSERT_EQ(QuickHullAlgorithm::runCompleteInPlace(square).size(), 4);
+}
+
+TEST(QuickHullSoA, MatchesSerial) {
+    RandomPointProvider random(100000, LONG_MAX, LONG_MAX);
+    auto pts = random.getPoints();
+    QuickHullAlgorithm alg(pts);
+    ASSERT_EQ(runQuick(pts), alg.runCompleteAlgorithm(PointSoA(pts)));
+
+    CirclePointProvider circle(1000, 1200, 800);
+    auto circlePts = circle.getPoints();
+    ASSERT_EQ(runQuick(circlePts), alg.runCompleteAlgorithm(PointSoA(circlePts)));
+}
+
+TEST(QuickHullStepping, MatchesComplete) {
+    RandomPointProvider random(20000, LONG_MAX, LONG_MAX);
+    CirclePointProvider circle(2000, 1200, 800);
+    std::vector<Point> square{{0,0},{2,0},{2,2},{0,2},{1,0},{1,2},{1,1},{2,2},{0,0}};
+    for (const auto& pts : {random.getPoints(), circle.getPoints(), square}) {
+        QuickHullAlgorithm alg(pts);
+        while (alg.step()) {}
+        ASSERT_TRUE(alg.isFinished());
+        EXPECT_EQ(alg.getCurrentHull(), runQuick(pts)) << pts.size();
+    }
+}
+
+TEST(QuickHullStepping, PointStatesFollowTheTasks) {
+    RandomPointProvider prov(5000, 1200, 800);
+    auto pts = prov.getPoints();
+    QuickHullAlgorithm alg(pts);
+    ASSERT_EQ(alg.getPointStates().size(), pts.size());
+
+    size_t previews = 0;
+    while (alg.step()) {
+        if (!alg.isInPreviewPhase()) continue;
+        previews++;
+
+        // Every active point is a candidate of the level being previewed, and the
+        // points marked as hull points are the vertices added so far
+        auto candidates = alg.getCandidatePoints();
+        std::vector<Point> active;
+        std::vector<Point> hullPoints;
+        for (size_t i = 0; i < pts.size(); i++) {
+            if (alg.getPointStates()[i] == QuickHullAlgorithm::PointState::ACTIVE) active.push_back(pts[i]);
+            if (alg.getPointStates()[i] == QuickHullAlgorithm::PointState::HULL) hullPoints.push_back(pts[i]);
+        }
+        auto hull = alg.getCurrentHull();
+        std::sort(candidates.begin(), candidates.end());
+        std::sort(active.begin(), active.end());
+        std::sort(hullPoints.begin(), hullPoints.end());
+        std::sort(hull.begin(), hull.end());
+        EXPECT_EQ(active, candidates);
+        EXPECT_EQ(hullPoints, hull);
+    }
+    EXPECT_GT(previews, 0);
+    for (const auto state : alg.getPointStates()) {
+        EXPECT_NE(state, QuickHullAlgorithm::PointState::ACTIVE);
+    }
+}
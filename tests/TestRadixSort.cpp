@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/RadixSort.h"
+#include "point_providers/CirclePointProvider.h"
+#include "point_providers/LinePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+// Equal points are indistinguishable, so the result must be exactly the sorted sequence
+template <class T>
+static void expectSorted(std::vector<BasicPoint<T>> pts, WorkStealingPool* pool = nullptr) {
+    std::vector<BasicPoint<T>> expected = pts;
+    std::sort(expected.begin(), expected.end());
+    std::vector<BasicPoint<T>> scratch;
+    radixSortPoints(pts, scratch, pool, 1000);
+    EXPECT_EQ(pts, expected);
+}
+
+TEST(RadixSort, FloatKeysKeepOrder) {
+    const float values[] = {
+        -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::max(), -1.5f, -1.0f,
+        -std::numeric_limits<float>::denorm_min(), 0.0f, std::numeric_limits<float>::denorm_min(),
+        std::numeric_limits<float>::min(), 1.0f, 1.5f, std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::infinity()};
+    for (size_t i = 0; i + 1 < std::size(values); i++) {
+        EXPECT_LT(radixKey(values[i]), radixKey(values[i + 1])) << values[i];
+    }
+    EXPECT_EQ(radixKey(-0.0f), radixKey(0.0f));
+    EXPECT_EQ(radixKey(-0.0), radixKey(0.0));
+}
+
+TEST(RadixSort, IntegerKeysKeepOrder) {
+    EXPECT_LT(radixKey(INT32_MIN), radixKey(std::int32_t{-1}));
+    EXPECT_LT(radixKey(std::int32_t{-1}), radixKey(std::int32_t{0}));
+    EXPECT_LT(radixKey(std::int32_t{0}), radixKey(INT32_MAX));
+    EXPECT_LT(radixKey(INT64_MIN), radixKey(std::int64_t{-1}));
+    EXPECT_LT(radixKey(std::int64_t{0}), radixKey(INT64_MAX));
+}
+
+TEST(RadixSort, SortsProviderPoints) {
+    expectSorted(RandomPointProvider(20000, LONG_MAX, LONG_MAX, 0).getPoints());
+    expectSorted(RandomPointProvider(20000, 1200, 800).getPoints());
+    expectSorted(SquarePointProvider(20000, 1200, 800).getPoints());
+    expectSorted(LinePointProvider(20000, 1200, 800).getPoints());
+    expectSorted(CirclePointProvider(10000, 1200, 800).getPoints());
+}
+
+TEST(RadixSort, SortsNegativeAndMixedCoordinates) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(-1.0e6f, 1.0e6f);
+    std::uniform_int_distribution<int> small(-3, 3);
+    std::vector<Point> pts;
+    for (int i = 0; i < 20000; i++) {
+        // Half of the points share a few x values, so the y passes decide their order
+        const float x = i % 2 ? coord(rng) : static_cast<float>(small(rng));
+        pts.push_back({x, coord(rng)});
+    }
+    pts.push_back({-0.0f, 1.0f});
+    pts.push_back({0.0f, 1.0f});
+    expectSorted(pts);
+}
+
+TEST(RadixSort, SortsEveryCoordinateType) {
+    std::mt19937_64 rng(5);
+    std::vector<DoublePoint> doubles;
+    std::vector<Int32Point> ints;
+    std::vector<Int64Point> longs;
+    for (int i = 0; i < 10000; i++) {
+        const auto a = static_cast<std::int64_t>(rng());
+        const auto b = static_cast<std::int64_t>(rng());
+        doubles.push_back({static_cast<double>(a) * 1e-10, static_cast<double>(b % 7)});
+        ints.push_back({static_cast<std::int32_t>(a >> 32), static_cast<std::int32_t>(b % 100)});
+        longs.push_back({a, b});
+    }
+    expectSorted(doubles);
+    expectSorted(ints);
+    expectSorted(longs);
+}
+
+TEST(RadixSort, ParallelHistogramMatchesSerial) {
+    WorkStealingPool pool(4);
+    RandomPointProvider prov(100000, LONG_MAX, LONG_MAX, 0);
+    prov.setSeed(9);
+    expectSorted(prov.getPoints(), &pool);
+}
+
+TEST(RadixSort, AndrewRadixModeMatchesComparisonMode) {
+    const std::vector<std::vector<Point>> inputs{
+        {},
+        {{1, 1}},
+        {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {1, 0}, {1, 2}},
+        RandomPointProvider(50000, LONG_MAX, LONG_MAX, 0).getPoints(),
+        RandomPointProvider(50000, 1200, 800).getPoints(),
+        SquarePointProvider(50000, 1200, 800).getPoints(),
+        LinePointProvider(5000, 1200, 800).getPoints(),
+        CirclePointProvider(10000, 1200, 800).getPoints(),
+    };
+    for (unsigned threads : {1u, 4u}) {
+        AndrewAlgorithm comparison({});
+        AndrewAlgorithm radix({});
+        comparison.setThreadCount(threads);
+        radix.setThreadCount(threads);
+        radix.setSortMode(AndrewAlgorithm::SortMode::RADIX);
+        for (const auto& pts : inputs) {
+            EXPECT_EQ(radix.runCompleteAlgorithm(pts), comparison.runCompleteAlgorithm(pts))
+                << pts.size() << " points, " << threads << " threads";
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/SlidingWindowHull.h"
+
+static std::vector<Point> andrewHull(const std::vector<Point>& pts) {
+    return AndrewAlgorithm(pts).runCompleteAlgorithm(pts);
+}
+
+static std::vector<Point> randomStream(size_t n, int range, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coord(0, range);
+    std::vector<Point> pts;
+    for (size_t i = 0; i < n; i++) pts.push_back({coord(rng), coord(rng)});
+    return pts;
+}
+
+TEST(SlidingWindow, CountWindowMatchesAndrew) {
+    const auto stream = randomStream(5000, 1000, 1);
+
+    for (size_t window : {1u, 3u, 50u, 700u}) {
+        for (size_t block : {0u, 4u, 64u}) {
+            SlidingWindowHull hull(SlidingWindowHull::Window::COUNT, static_cast<double>(window), block);
+            for (size_t i = 0; i < stream.size(); i++) {
+                hull.push(stream[i]);
+                const size_t begin = i + 1 > window ? i + 1 - window : 0;
+                ASSERT_EQ(hull.size(), i + 1 - begin);
+
+                if (i % 37 == 0 && hull.size() > 2) {
+                    std::vector<Point> current(stream.begin() + static_cast<std::ptrdiff_t>(begin),
+                                               stream.begin() + static_cast<std::ptrdiff_t>(i + 1));
+                    ASSERT_EQ(hull.hull(), andrewHull(current)) << "window " << window << " block " << block << " at " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(SlidingWindow, TimeWindowMatchesAndrew) {
+    const auto stream = randomStream(3000, 500, 2);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> gap(0.0, 0.01);
+
+    std::vector<double> times;
+    double t = 0.0;
+    for (size_t i = 0; i < stream.size(); i++) {
+        t += gap(rng);
+        times.push_back(t);
+    }
+
+    const double duration = 1.5;
+    SlidingWindowHull hull(SlidingWindowHull::Window::TIME, duration, 32);
+    for (size_t i = 0; i < stream.size(); i++) {
+        hull.push(stream[i], times[i]);
+
+        std::vector<Point> current;
+        for (size_t j = 0; j <= i; j++) {
+            if (times[j] > times[i] - duration) current.push_back(stream[j]);
+        }
+        ASSERT_EQ(hull.size(), current.size());
+        if (i % 53 == 0 && current.size() > 2) {
+            ASSERT_EQ(hull.hull(), andrewHull(current)) << "at " << i;
+        }
+    }
+
+    // Without new points the whole window eventually expires
+    hull.advanceTo(t + duration);
+    EXPECT_EQ(hull.size(), 0);
+    EXPECT_TRUE(hull.hull().empty());
+}
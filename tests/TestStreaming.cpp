@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "algorithms/AndrewAlgorithm.h"
+#include "point_providers/FromFilePointProvider.h"
+#include "point_providers/RandomPointProvider.h"
+#include "streaming/ChunkedPointReader.h"
+#include "streaming/StreamingHull.h"
+
+static std::string writePoints(const std::string& name, const std::vector<Point>& pts) {
+    std::ofstream file(name);
+    file << pts.size() << "\n";
+    for (const auto& p : pts) {
+        file << p.x << "," << p.y << "\n";
+    }
+    return name;
+}
+
+TEST(ChunkedReader, ReadsAllPointsInChunks) {
+    auto pts = RandomPointProvider(1000, 1200, 800).getPoints();
+    const auto file = writePoints("stream_reader.txt", pts);
+
+    ChunkedPointReader reader(file, 128);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_EQ(reader.getDeclaredCount(), 1000);
+
+    std::vector<Point> chunk;
+    std::vector<Point> all;
+    size_t chunks = 0;
+    while (reader.next(chunk)) {
+        ASSERT_LE(chunk.size(), 128);
+        all.insert(all.end(), chunk.begin(), chunk.end());
+        chunks++;
+    }
+    EXPECT_EQ(chunks, 8);
+    EXPECT_EQ(all, FromFilePointProvider(file).getPoints());
+    std::remove(file.c_str());
+}
+
+TEST(ChunkedReader, MissingFile) {
+    ChunkedPointReader reader("does_not_exist.txt", 16);
+    std::vector<Point> chunk;
+    EXPECT_FALSE(reader.isOpen());
+    EXPECT_FALSE(reader.next(chunk));
+}
+
+TEST(StreamingHull, MatchesInMemoryHull) {
+    auto pts = RandomPointProvider(50000, LONG_MAX, LONG_MAX).getPoints();
+    const auto file = writePoints("stream_hull.txt", pts);
+    auto loaded = FromFilePointProvider(file).getPoints();
+    auto expected = AndrewAlgorithm(loaded).runCompleteAlgorithm(loaded);
+
+    for (size_t chunkSize : {1, 7, 1000, 100000}) {
+        StreamingHull hull;
+        ASSERT_TRUE(StreamingHull::fromFile(file, chunkSize, hull));
+        EXPECT_EQ(hull.getHull(), expected);
+        EXPECT_EQ(hull.getPointCount(), loaded.size());
+        // Intermediate hulls of a random set stay small, so memory is bounded by the chunk
+        EXPECT_LE(hull.getPeakPoints(), std::min(chunkSize + 100, loaded.size() + expected.size()));
+    }
+    std::remove(file.c_str());
+}
+
+TEST(StreamingHull, ChunksInMemory) {
+    std::vector<Point> square{{0,0},{4,0},{4,4},{0,4}};
+    StreamingHull hull;
+    hull.addChunk({{1,1},{2,2}});
+    hull.addChunk({{0,0},{4,0}});
+    hull.addChunk({{4,4},{0,4},{2,1}});
+    hull.addChunk({});
+
+    EXPECT_EQ(hull.getHull(), AndrewAlgorithm(square).runCompleteAlgorithm(square));
+    EXPECT_EQ(hull.getChunkCount(), 3);
+    EXPECT_EQ(hull.getPointCount(), 7);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "algorithms/WorkStealingPool.h"
+#include "point_providers/FromFilePointProvider.h"
+#include "point_providers/PointTextParser.h"
+#include "point_providers/RandomPointProvider.h"
+
+static PointTextParser::Result parseText(const std::string& text, WorkStealingPool* pool = nullptr) {
+    return PointTextParser::parse(text.data(), text.size(), pool);
+}
+
+TEST(TextParser, IntegerAndFloatLines) {
+    auto r = parseText("4\n760,400\n757.161,445.12\n-3, 4\r\n1e2 ,-2.5\n");
+    ASSERT_TRUE(r.validHeader);
+    EXPECT_EQ(r.declaredCount, 4);
+    EXPECT_EQ(r.malformedLines, 0);
+    EXPECT_EQ(r.points, (std::vector<Point>{{760, 400}, {757.161f, 445.12f}, {-3, 4}, {100.0f, -2.5f}}));
+}
+
+TEST(TextParser, ReportsMalformedLines) {
+    auto r = parseText("5\n1,2\nabc\n3;4\n5,6,7\n8,9");
+    EXPECT_EQ(r.points, (std::vector<Point>{{1, 2}, {8, 9}}));
+    EXPECT_EQ(r.malformedLines, 3);
+    ASSERT_EQ(r.errors.size(), 3);
+    EXPECT_EQ(r.errors[0].line, 3);
+    EXPECT_EQ(r.errors[0].text, "abc");
+    EXPECT_EQ(r.errors[1].line, 4);
+    EXPECT_EQ(r.errors[2].line, 5);
+    EXPECT_EQ(r.errors[2].text, "5,6,7");
+}
+
+TEST(TextParser, DeclaredCountLimitsLines) {
+    auto r = parseText("2\n1,1\n2,2\n3,3\n");
+    EXPECT_EQ(r.points.size(), 2);
+
+    auto shortFile = parseText("30\n1,1\n2,2\n");
+    EXPECT_EQ(shortFile.points.size(), 2);
+    EXPECT_EQ(shortFile.malformedLines, 0);
+}
+
+TEST(TextParser, InvalidHeader) {
+    auto r = parseText("points\n1,2\n");
+    EXPECT_FALSE(r.validHeader);
+    EXPECT_TRUE(r.points.empty());
+    ASSERT_EQ(r.errors.size(), 1);
+    EXPECT_EQ(r.errors[0].line, 1);
+}
+
+TEST(TextParser, ParallelMatchesSerial) {
+    auto pts = RandomPointProvider(300000, LONG_MAX, LONG_MAX).getPoints();
+    std::ostringstream os;
+    os << pts.size() << "\n";
+    for (size_t i = 0; i < pts.size(); i++) {
+        os << pts[i].x << "," << pts[i].y << "\n";
+        if (i % 50000 == 7) os << "broken line\n";
+    }
+    const std::string text = os.str();
+
+    WorkStealingPool pool(4);
+    auto serial = parseText(text);
+    auto parallel = parseText(text, &pool);
+
+    EXPECT_EQ(serial.points, parallel.points);
+    EXPECT_EQ(serial.malformedLines, parallel.malformedLines);
+    ASSERT_EQ(serial.errors.size(), parallel.errors.size());
+    for (size_t i = 0; i < serial.errors.size(); i++) {
+        EXPECT_EQ(serial.errors[i].line, parallel.errors[i].line);
+        EXPECT_EQ(serial.errors[i].text, "broken line");
+    }
+}
+
+TEST(TextParser, ProviderMatchesStreamParsing) {
+    const std::vector<std::string> files = {
+        "../../point_files/random.txt",
+        "../../point_files/floats.txt",
+        "../../point_files/triangle.txt",
+    };
+    for (const auto& f : files) {
+        std::ifstream file(f);
+        if (!file.good()) continue;
+
+        // Reference: the original stream-based loop
+        std::vector<Point> expected;
+        int n;
+        file >> n;
+        std::string line;
+        std::getline(file, line);
+        for (int i = 0; i < n && std::getline(file, line); i++) {
+            std::stringstream ss(line);
+            float x, y;
+            char comma;
+            if (ss >> x >> comma >> y) expected.push_back({x, y});
+        }
+
+        FromFilePointProvider provider(f);
+        provider.setThreadCount(2);
+        EXPECT_EQ(provider.getPoints(), expected) << f;
+        EXPECT_EQ(provider.getMalformedLineCount(), 0) << f;
+    }
+}
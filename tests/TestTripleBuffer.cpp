@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "visualization/TripleBuffer.h"
+
+// A published frame holds its number in every element, so a frame the reader sees
+// half-written has mixed values
+struct Frame {
+    long number = 0;
+    std::vector<long> values;
+};
+
+static void fill(Frame& frame, long number) {
+    frame.number = number;
+    frame.values.assign(64, number);
+}
+
+static bool isWhole(const Frame& frame) {
+    for (long v : frame.values) {
+        if (v != frame.number) return false;
+    }
+    return true;
+}
+
+TEST(TripleBuffer, UpdateOnlyAfterPublish) {
+    TripleBuffer<Frame> buffer;
+    EXPECT_FALSE(buffer.update());
+    EXPECT_EQ(buffer.front().number, 0);
+
+    fill(buffer.back(), 1);
+    buffer.publish();
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.front().number, 1);
+    EXPECT_FALSE(buffer.update());
+    EXPECT_EQ(buffer.front().number, 1);
+
+    // Of two publishes between updates only the later one is seen
+    fill(buffer.back(), 2);
+    buffer.publish();
+    fill(buffer.back(), 3);
+    buffer.publish();
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.front().number, 3);
+    EXPECT_TRUE(isWhole(buffer.front()));
+    EXPECT_FALSE(buffer.update());
+}
+
+TEST(TripleBuffer, ReaderSeesWholeFramesInOrder) {
+    constexpr long FRAMES = 100000;
+    TripleBuffer<Frame> buffer;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        for (long n = 1; n <= FRAMES; n++) {
+            fill(buffer.back(), n);
+            buffer.publish();
+        }
+        done.store(true);
+    });
+
+    long last = 0;
+    long reads = 0;
+    bool ordered = true;
+    bool whole = true;
+    auto read = [&] {
+        if (!buffer.update()) return;
+        const Frame& frame = buffer.front();
+        ordered = ordered && frame.number > last;
+        whole = whole && isWhole(frame);
+        last = frame.number;
+        reads++;
+    };
+    while (!done.load()) {
+        read();
+    }
+    writer.join();
+    read();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(whole);
+    EXPECT_GT(reads, 0);
+    // The last frame always arrives, and nothing is left to pick up after it
+    EXPECT_EQ(buffer.front().number, FRAMES);
+    EXPECT_FALSE(buffer.update());
+}
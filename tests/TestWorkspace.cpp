@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include "algorithms/AndrewAlgorithm.h"
+#include "algorithms/QuickhullAlgorithm.h"
+#include "point_providers/RandomPointProvider.h"
+#include "point_providers/SquarePointProvider.h"
+
+// Counts every allocation of the test binary that goes through the global operator new
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+// Out of line, so GCC does not inline free() into delete expressions and report it as
+// mismatched with the new above
+[[gnu::noinline]] static void release(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p) noexcept {
+    release(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    release(p);
+}
+
+static std::vector<std::vector<Point>> makeInputs() {
+    std::vector<std::vector<Point>> inputs{
+        {},
+        {{1, 2}},
+        {{1, 2}, {3, 4}},
+        {{0, 0}, {0, 0}, {0, 0}},
+        {{0, 0}, {1, 0}, {2, 0}, {-1, 0}},
+        {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {1, 0}, {1, 2}, {1, 1}},
+    };
+    for (unsigned seed : {1u, 2u, 3u}) {
+        RandomPointProvider prov(5000 * seed, 1200, 800);
+        prov.setSeed(seed);
+        inputs.push_back(prov.getPoints());
+    }
+    inputs.push_back(SquarePointProvider(2000, 1200, 800).getPoints());
+
+    // Near-collinear points between two far endpoints: QuickHull's float farthest-point
+    // choice adds non-vertices here, which repairHull removes
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> coord(1100000.0f, 2000000.0f);
+    std::uniform_int_distribution<int> ulps(-3, 3);
+    std::vector<Point> diagonal{{1000000.0f, 1000000.0f}, {2100000.0f, 2100000.0f}};
+    for (int i = 0; i < 3000; i++) {
+        const float x = coord(rng);
+        diagonal.push_back({x, x + ulps(rng) * 0.125f});
+    }
+    inputs.push_back(diagonal);
+    return inputs;
+}
+
+TEST(Workspace, AndrewMatchesRunComplete) {
+    AndrewAlgorithm::Workspace workspace;
+    std::vector<Point> hull;
+    for (const auto& pts : makeInputs()) {
+        AndrewAlgorithm::computeHull(pts, hull, workspace);
+        EXPECT_EQ(hull, AndrewAlgorithm(pts).runCompleteAlgorithm(pts)) << pts.size();
+    }
+}
+
+TEST(Workspace, QuickHullMatchesRunComplete) {
+    QuickHullAlgorithm::Workspace workspace;
+    std::vector<Point> hull;
+    for (const auto& pts : makeInputs()) {
+        QuickHullAlgorithm::computeHull(pts, hull, workspace);
+        auto expected = QuickHullAlgorithm(pts).runCompleteAlgorithm(pts);
+        // Collinear inputs keep their points in input order, so compare as sets
+        std::sort(hull.begin(), hull.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(hull, expected) << pts.size();
+    }
+}
+
+// Every index refers to a point equal to the corresponding vertex of the point mode
+template <class Algorithm>
+static void expectIndicesMatchPoints() {
+    typename Algorithm::Workspace workspace;
+    std::vector<Point> hull;
+    std::vector<std::uint32_t> indices;
+    for (const auto& pts : makeInputs()) {
+        Algorithm::computeHull(pts, hull, workspace);
+        ASSERT_TRUE(Algorithm::computeHullIndices(pts, indices, workspace));
+        ASSERT_EQ(indices.size(), hull.size()) << pts.size();
+        for (size_t k = 0; k < indices.size(); k++) {
+            ASSERT_LT(indices[k], pts.size());
+            EXPECT_EQ(pts[indices[k]], hull[k]) << pts.size() << " " << k;
+        }
+    }
+}
+
+TEST(Workspace, AndrewIndicesMatchPoints) {
+    expectIndicesMatchPoints<AndrewAlgorithm>();
+}
+
+TEST(Workspace, QuickHullIndicesMatchPoints) {
+    expectIndicesMatchPoints<QuickHullAlgorithm>();
+}
+
+TEST(Workspace, DuplicatesReportOneIndex) {
+    const std::vector<Point> pts{{0, 0}, {4, 0}, {0, 0}, {4, 4}, {0, 4}, {4, 4}, {2, 2}};
+    AndrewAlgorithm::Workspace andrewWorkspace;
+    QuickHullAlgorithm::Workspace quickHullWorkspace;
+    std::vector<std::uint32_t> a;
+    std::vector<std::uint32_t> q;
+    AndrewAlgorithm::computeHullIndices(pts, a, andrewWorkspace);
+    QuickHullAlgorithm::computeHullIndices(pts, q, quickHullWorkspace);
+
+    ASSERT_EQ(a.size(), 4);
+    ASSERT_EQ(q.size(), 4);
+    std::vector<Point> corners;
+    for (const std::uint32_t i : a) corners.push_back(pts[i]);
+    std::sort(corners.begin(), corners.end());
+    EXPECT_EQ(corners, (std::vector<Point>{{0, 0}, {0, 4}, {4, 0}, {4, 4}}));
+}
+
+TEST(Workspace, SteadyStateCallsDoNotAllocate) {
+    // The near-collinear set also takes the rebuild of repairHull
+    const auto inputs = makeInputs();
+
+    AndrewAlgorithm::Workspace andrewWorkspace;
+    QuickHullAlgorithm::Workspace quickHullWorkspace;
+    std::vector<Point> andrewHull;
+    std::vector<Point> quickHullHull;
+    std::vector<std::uint32_t> andrewIndices;
+    std::vector<std::uint32_t> quickHullIndices;
+
+    // The first round grows the buffers to the largest input
+    auto runAll = [&] {
+        for (const auto& pts : inputs) {
+            AndrewAlgorithm::computeHull(pts, andrewHull, andrewWorkspace);
+            QuickHullAlgorithm::computeHull(pts, quickHullHull, quickHullWorkspace);
+            AndrewAlgorithm::computeHullIndices(pts, andrewIndices, andrewWorkspace);
+            QuickHullAlgorithm::computeHullIndices(pts, quickHullIndices, quickHullWorkspace);
+        }
+    };
+    runAll();
+
+    const size_t before = g_allocations.load();
+    for (int round = 0; round < 3; round++) {
+        runAll();
+    }
+    EXPECT_EQ(g_allocations.load() - before, 0);
+
+    // The hook itself works: the vector-returning API allocates
+    const size_t beforeVector = g_allocations.load();
+    auto hull = AndrewAlgorithm({}).runCompleteAlgorithm(inputs.back());
+    EXPECT_GT(g_allocations.load() - beforeVector, 0);
+}
@@ -0,0 +1,34 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include "point_providers/BinaryPointFormat.h"
+#include "point_providers/FromFilePointProvider.h"
+
+// Converts a text point file (count line, then "x,y" lines) to the binary format:
+//   convex_convert <points.txt> <points.bin>
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <points.txt> <points.bin>" << std::endl;
+        return 1;
+    }
+
+    FromFilePointProvider provider(argv[1]);
+    provider.setThreadCount(std::thread::hardware_concurrency());
+    const std::vector<Point> points = provider.getPoints();
+
+    for (const auto& error : provider.getErrors()) {
+        std::cerr << "Skipped malformed line " << error.line << ": " << error.text << std::endl;
+    }
+    if (points.empty()) {
+        std::cerr << "No points read from " << argv[1] << std::endl;
+        return 1;
+    }
+
+    if (!writeBinaryPoints(argv[2], points)) {
+        std::cerr << "Cannot write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << points.size() << " points to " << argv[2] << std::endl;
+    return 0;
+}
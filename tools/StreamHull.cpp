@@ -0,0 +1,62 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "streaming/StreamingHull.h"
+
+// Command line entry point for the out-of-core hull:
+//   convex_stream <points.txt> [chunk size] [-o hull.txt]
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <points.txt> [chunk size] [-o hull.txt]" << std::endl;
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output;
+    size_t chunkSize = 1 << 20;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            const long value = std::strtol(arg.c_str(), nullptr, 10);
+            if (value <= 0) {
+                std::cerr << "Invalid chunk size: " << arg << std::endl;
+                return 1;
+            }
+            chunkSize = static_cast<size_t>(value);
+        }
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    StreamingHull hull;
+    if (!StreamingHull::fromFile(input, chunkSize, hull)) {
+        std::cerr << "File not found: " << input << std::endl;
+        return 1;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    std::cout << "Points: " << hull.getPointCount() << std::endl;
+    std::cout << "Chunks: " << hull.getChunkCount() << " (chunk size " << chunkSize << ")" << std::endl;
+    std::cout << "Peak points in memory: " << hull.getPeakPoints() << std::endl;
+    std::cout << "Hull points: " << hull.getHull().size() << std::endl;
+    std::cout << "Time: " << ms << "ms" << std::endl;
+
+    if (!output.empty()) {
+        // Same format as the input files, so the hull can be loaded again
+        std::ofstream file(output);
+        if (!file.is_open()) {
+            std::cerr << "Cannot write " << output << std::endl;
+            return 1;
+        }
+        file << hull.getHull().size() << "\n";
+        for (const auto& p : hull.getHull()) {
+            file << p.x << "," << p.y << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,233 @@
+#include "AlgorithmWorker.h"
+#include "../algorithms/QuickhullAlgorithm.h"
+#include "../algorithms/AndrewAlgorithm.h"
+#include "../algorithms/ChanAlgorithm.h"
+#include <algorithm>
+
+// Longest stretch of back-to-back autoplay steps before queued commands are looked at
+constexpr std::chrono::milliseconds STEP_SLICE{16};
+
+AlgorithmWorker::AlgorithmWorker(const std::vector<Point>& points, const PointQuadtree& tree,
+                                 std::unique_ptr<IAlgorithm> algorithm)
+: m_points(points),
+  m_tree(tree),
+  m_algorithm(std::move(algorithm))
+{
+    m_byCoordinate.resize(m_points.size());
+    for (std::size_t i = 0; i < m_points.size(); i++) {
+        m_byCoordinate[i] = static_cast<std::uint32_t>(i);
+    }
+    std::sort(m_byCoordinate.begin(), m_byCoordinate.end(),
+              [this](std::uint32_t a, std::uint32_t b) { return m_points[a] < m_points[b]; });
+
+    m_thread = std::thread([this] { run(); });
+}
+
+AlgorithmWorker::~AlgorithmWorker() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void AlgorithmWorker::step() {
+    push({Command::Type::STEP});
+}
+
+void AlgorithmWorker::reset() {
+    push({Command::Type::RESET});
+}
+
+void AlgorithmWorker::select(Maker make) {
+    push({Command::Type::SELECT, 0, std::move(make)});
+}
+
+void AlgorithmWorker::setAutoPlay(bool autoPlay) {
+    push({Command::Type::AUTOPLAY, autoPlay ? 1.0 : 0.0});
+}
+
+void AlgorithmWorker::setStepsPerSecond(double stepsPerSecond) {
+    push({Command::Type::RATE, stepsPerSecond});
+}
+
+void AlgorithmWorker::push(Command command) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_commands.push_back(std::move(command));
+    }
+    m_wake.notify_one();
+}
+
+void AlgorithmWorker::run() {
+    publish();
+
+    Clock::time_point nextStep = Clock::now();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop) {
+        // Take the queued commands and run everything else without holding the lock
+        std::deque<Command> commands;
+        commands.swap(m_commands);
+        lock.unlock();
+
+        bool changed = false;
+        for (Command& command : commands) {
+            if (command.type == Command::Type::AUTOPLAY && command.value != 0 && !m_autoPlay) {
+                nextStep = Clock::now();
+            }
+            changed |= execute(command);
+        }
+
+        // Autoplay: the steps that are due, one after the other when the rate is higher
+        // than the steps are fast; a backlog is dropped rather than caught up on
+        if (m_autoPlay && !m_algorithm->isFinished()) {
+            const auto interval = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / m_stepsPerSecond));
+            const Clock::time_point sliceEnd = Clock::now() + STEP_SLICE;
+            Clock::time_point now = Clock::now();
+            while (nextStep <= now && now < sliceEnd && !m_algorithm->isFinished()) {
+                m_algorithm->step();
+                changed = true;
+                nextStep += interval;
+                now = Clock::now();
+            }
+            if (nextStep + interval < now) {
+                nextStep = now;
+            }
+        }
+
+        if (changed) {
+            publish();
+        }
+
+        lock.lock();
+        if (!m_commands.empty()) {
+            continue;
+        }
+        if (m_autoPlay && !m_algorithm->isFinished()) {
+            m_wake.wait_until(lock, nextStep, [this] { return m_stop || !m_commands.empty(); });
+        } else {
+            m_wake.wait(lock, [this] { return m_stop || !m_commands.empty(); });
+        }
+    }
+}
+
+// Returns true if the algorithm state changed
+bool AlgorithmWorker::execute(Command& command) {
+    switch (command.type) {
+        case Command::Type::STEP:
+            m_algorithm->step();
+            return true;
+        case Command::Type::RESET:
+            m_algorithm->reset(m_points);
+            return true;
+        case Command::Type::SELECT:
+            m_algorithm = command.make();
+            m_algorithm->reset(m_points);
+            return true;
+        case Command::Type::AUTOPLAY:
+            m_autoPlay = command.value != 0;
+            return false;
+        case Command::Type::RATE:
+            m_stepsPerSecond = command.value;
+            return false;
+    }
+    return false;
+}
+
+// Classify all points by their rendering role and hand the state to the window thread
+void AlgorithmWorker::publish() {
+    AndrewAlgorithm* andrew = dynamic_cast<AndrewAlgorithm*>(m_algorithm.get());
+    QuickHullAlgorithm* quickhull = dynamic_cast<QuickHullAlgorithm*>(m_algorithm.get());
+    ChanAlgorithm* chan = dynamic_cast<ChanAlgorithm*>(m_algorithm.get());
+    using Role = PointRole;
+
+    SceneSnapshot& snapshot = m_snapshots.back();
+
+    // Every point starts as NORMAL
+    std::vector<Role>& roles = snapshot.roles;
+    roles.assign(m_points.size(), Role::NORMAL);
+    snapshot.markers.clear();
+    auto mark = [&](const Point& p, Role role) {
+        for (const std::uint32_t i : indicesAt(p)) {
+            roles[i] = role;
+        }
+    };
+
+    // Get algorithm-specific data
+    snapshot.hull = m_algorithm->getCurrentHull();
+    snapshot.finished = m_algorithm->isFinished();
+    snapshot.closedHull = snapshot.finished || !(andrew || chan);
+
+    // Classify points based on algorithm state: the candidates are the points of the
+    // tasks being previewed, the inactive ones were eliminated
+    snapshot.segments.clear();
+    if (quickhull && quickhull->hasActiveSegments()) {
+        const auto& states = quickhull->getPointStates();
+        for (size_t i = 0; i < roles.size() && i < states.size(); i++) {
+            if (states[i] == QuickHullAlgorithm::PointState::INACTIVE) {
+                roles[i] = Role::INACTIVE;
+            } else if (states[i] == QuickHullAlgorithm::PointState::ACTIVE) {
+                roles[i] = Role::CANDIDATE;
+            }
+        }
+        // Mark farthest points (only in preview)
+        if (quickhull->isInPreviewPhase()) {
+            for (const Point& p : quickhull->getFarthestPoints()) {
+                mark(p, Role::FARTHEST);
+            }
+        }
+        snapshot.segments = quickhull->getActiveSegments();
+    }
+
+    // Mark hull points (override previous classifications except CURRENT and FARTHEST)
+    for (const Point& p : snapshot.hull) {
+        for (const std::uint32_t i : indicesAt(p)) {
+            if (roles[i] != Role::CURRENT && roles[i] != Role::FARTHEST) {
+                roles[i] = Role::HULL;
+            }
+        }
+    }
+
+    if (andrew && !andrew->isFinished()) {
+        mark(andrew->getCurrentPoint(), Role::CANDIDATE);
+        snapshot.markers.push_back({andrew->getCurrentPoint(), Role::CANDIDATE});
+    }
+
+    if (chan && chan->hasCurrentPoint()) {
+        mark(chan->getCurrentPoint(), Role::CANDIDATE);
+        snapshot.markers.push_back({chan->getCurrentPoint(), Role::CANDIDATE});
+    }
+
+    // Mini hulls of the current Chan round
+    snapshot.miniHulls.clear();
+    if (chan && chan->getPhase() == ChanAlgorithm::Phase::WRAPPING) {
+        snapshot.miniHulls = chan->getMiniHulls();
+    }
+
+    // Role counts along the quadtree order, for the density cells
+    const auto& order = m_tree.order();
+    for (auto* before : {&snapshot.inactiveBefore, &snapshot.candidatesBefore, &snapshot.farthestBefore,
+                         &snapshot.hullBefore}) {
+        before->resize(order.size() + 1);
+        (*before)[0] = 0;
+    }
+    for (size_t k = 0; k < order.size(); k++) {
+        const Role role = roles[order[k]];
+        snapshot.inactiveBefore[k + 1] = snapshot.inactiveBefore[k] + (role == Role::INACTIVE);
+        snapshot.candidatesBefore[k + 1] = snapshot.candidatesBefore[k] + (role == Role::CANDIDATE);
+        snapshot.farthestBefore[k + 1] = snapshot.farthestBefore[k] + (role == Role::FARTHEST);
+        snapshot.hullBefore[k + 1] = snapshot.hullBefore[k] + (role == Role::HULL);
+    }
+
+    m_snapshots.publish();
+}
+
+std::span<const std::uint32_t> AlgorithmWorker::indicesAt(const Point& p) const {
+    const auto first = std::lower_bound(m_byCoordinate.begin(), m_byCoordinate.end(), p,
+        [this](std::uint32_t i, const Point& q) { return m_points[i] < q; });
+    const auto last = std::upper_bound(first, m_byCoordinate.end(), p,
+        [this](const Point& q, std::uint32_t i) { return q < m_points[i]; });
+    return {first, last};
+}
@@ -0,0 +1,81 @@
+#ifndef ALGORITHMWORKER_H
+#define ALGORITHMWORKER_H
+
+#include "../point_providers/Point.h"
+#include "../point_providers/PointQuadtree.h"
+#include "../algorithms/IAlgorithm.h"
+#include "SceneSnapshot.h"
+#include "TripleBuffer.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Runs the algorithm on its own thread. The window thread queues commands and picks up
+// snapshots from a triple buffer, so a long step never stalls rendering. Autoplay steps
+// at a fixed rate per second, independent of the frame rate.
+class AlgorithmWorker {
+public:
+    using Maker = std::function<std::unique_ptr<IAlgorithm>()>;
+
+    // tree indexes points and must outlive the worker
+    AlgorithmWorker(const std::vector<Point>& points, const PointQuadtree& tree,
+                    std::unique_ptr<IAlgorithm> algorithm);
+    ~AlgorithmWorker();
+
+    AlgorithmWorker(const AlgorithmWorker&) = delete;
+    AlgorithmWorker& operator=(const AlgorithmWorker&) = delete;
+
+    void step();
+    void reset();
+    void select(Maker make);
+    void setAutoPlay(bool autoPlay);
+    void setStepsPerSecond(double stepsPerSecond);
+
+    // Window thread: swaps in the latest snapshot, false if there is none since the last call
+    bool updateSnapshot() { return m_snapshots.update(); }
+    const SceneSnapshot& snapshot() const { return m_snapshots.front(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Command {
+        enum class Type { STEP, RESET, SELECT, AUTOPLAY, RATE };
+        Type type;
+        double value = 0;
+        Maker make = {};
+    };
+
+    const std::vector<Point> m_points;
+    const PointQuadtree& m_tree;
+    // Input positions sorted by coordinate, for roles the algorithms report by coordinate
+    std::vector<std::uint32_t> m_byCoordinate;
+
+    // Owned by the worker thread
+    std::unique_ptr<IAlgorithm> m_algorithm;
+    bool m_autoPlay = false;
+    double m_stepsPerSecond = 6.0;
+    TripleBuffer<SceneSnapshot> m_snapshots;
+
+    // Shared, guarded by m_mutex; the worker holds it only to take the queued commands
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<Command> m_commands;
+    bool m_stop = false;
+
+    std::thread m_thread;
+
+    void push(Command command);
+    void run();
+    bool execute(Command& command);
+    void publish();
+    std::span<const std::uint32_t> indicesAt(const Point& p) const;
+};
+
+#endif
@@ -1,16 +1,22 @@
 #include "App.h"
-#include "../algorithms/QuickhullAlgorithm.h"
-#include "../algorithms/AndrewAlgorithm.h"
 #include "../assets/DejaVuSans.h"
-#include <map>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+constexpr const char* WINDOW_TITLE = "Convex Hull Visualisation";
 
 App::App(unsigned int w, unsigned int h, unsigned int frameLimit, const std::vector<Point>& points, std::unique_ptr<IAlgorithm> algorithm)
-: window(sf::VideoMode({w, h}), "Convex Hull Visualisation"),
+: window(sf::VideoMode({w, h}), WINDOW_TITLE),
   m_frameLimit(frameLimit),
   m_points(points),
-  m_algorithm(std::move(algorithm))
+  m_quadtree(points),
+  m_worker(points, m_quadtree, std::move(algorithm))
 {
     window.setFramerateLimit(m_frameLimit);
+    m_pointLayer.setPoints(m_points);
+    m_windowSize = window.getSize();
+    fitView();
     loadUiFont();
 }
 
@@ -21,9 +27,22 @@ void App::run()
         processEvents();
         update();
         render();
+        updateFrameRate();
     }
 }
 
+// Frames per second over the last second or so, shown in the title so it stays visible
+// with the help hidden
+void App::updateFrameRate()
+{
+    ++m_framesCounted;
+    const float seconds = m_frameClock.getElapsedTime().asSeconds();
+    if (seconds < 1.0f) return;
+    window.setTitle(std::string(WINDOW_TITLE) + " - " + std::to_string(std::lround(m_framesCounted / seconds)) + " fps");
+    m_framesCounted = 0;
+    m_frameClock.restart();
+}
+
 void App::setAlgorithms(std::vector<std::string> names,
                         std::vector<std::function<std::unique_ptr<IAlgorithm>()>> makers,
                         int initialIndex) {
@@ -37,8 +56,13 @@ void App::setAlgorithms(std::vector<std::string> names,
     } else {
         m_algoIndex = initialIndex;
     }
-    m_algorithm = m_algoMakers[m_algoIndex]();
-    m_algorithm->reset(m_points);
+    m_worker.select(m_algoMakers[m_algoIndex]);
+}
+
+// Autoplay rate in steps per second
+void App::setStepsPerSecond(double stepsPerSecond) {
+    m_stepsPerSecond = std::clamp(stepsPerSecond, MIN_STEPS_PER_SECOND, MAX_STEPS_PER_SECOND);
+    m_worker.setStepsPerSecond(m_stepsPerSecond);
 }
 
 void App::processEvents()
@@ -48,24 +72,35 @@ void App::processEvents()
         if (event->is<sf::Event::KeyPressed>()) {
             auto key = event->getIf<sf::Event::KeyPressed>()->scancode;
             if (key == sf::Keyboard::Scan::Space) {
-                m_algorithm->step();
+                m_worker.step();
             }
             if (key == sf::Keyboard::Scan::Enter) {
                 m_autoPlay = !m_autoPlay;
+                m_worker.setAutoPlay(m_autoPlay);
+            }
+            if (key == sf::Keyboard::Scan::Equal || key == sf::Keyboard::Scan::NumpadPlus) {
+                setStepsPerSecond(m_stepsPerSecond * 2);
+            }
+            if (key == sf::Keyboard::Scan::Hyphen || key == sf::Keyboard::Scan::NumpadMinus) {
+                setStepsPerSecond(m_stepsPerSecond / 2);
             }
             if (key == sf::Keyboard::Scan::Escape) {
                 window.close();
             }
             if (key == sf::Keyboard::Scan::R) {
-                m_algorithm->reset(m_points);
+                m_worker.reset();
             }
             if (key == sf::Keyboard::Scan::H) {
                 m_showHelp = !m_showHelp;
             }
+            if (key == sf::Keyboard::Scan::F) {
+                fitView();
+            }
 
             if (key >= sf::Keyboard::Scan::Num1 && key <= sf::Keyboard::Scan::Num9) {
 
                 m_autoPlay = false;
+                m_worker.setAutoPlay(false);
 
                 switch (key) {
                     case sf::Keyboard::Scan::Num1:    return selectAlgorithm(0);
@@ -81,194 +116,180 @@ void App::processEvents()
                 }
             }
         }
-    }
-}
 
-void App::update()
-{
-    if (m_autoPlay) {
-        if (++m_frameCounter % 10 == 0) {
-            m_algorithm->step();
+        if (const auto* resized = event->getIf<sf::Event::Resized>()) {
+            // Keep the scale, so the window shows more or less of the world instead of
+            // stretching it
+            if (m_windowSize.x > 0 && m_windowSize.y > 0) {
+                const float worldPerPixel = m_view.getSize().x / static_cast<float>(m_windowSize.x);
+                m_view.setSize(sf::Vector2f(resized->size) * worldPerPixel);
+            }
+            m_windowSize = resized->size;
+            m_viewDirty = true;
+        }
+        if (const auto* wheel = event->getIf<sf::Event::MouseWheelScrolled>()) {
+            zoomAt(wheel->position, wheel->delta > 0 ? 1.0f / 1.25f : 1.25f);
+        }
+        if (const auto* pressed = event->getIf<sf::Event::MouseButtonPressed>()) {
+            if (pressed->button == sf::Mouse::Button::Left) {
+                m_dragging = true;
+                m_lastMouse = pressed->position;
+            }
+        }
+        if (const auto* released = event->getIf<sf::Event::MouseButtonReleased>()) {
+            if (released->button == sf::Mouse::Button::Left) {
+                m_dragging = false;
+            }
+        }
+        if (const auto* moved = event->getIf<sf::Event::MouseMoved>()) {
+            if (m_dragging) {
+                m_view.move(window.mapPixelToCoords(m_lastMouse, m_view) - window.mapPixelToCoords(moved->position, m_view));
+                m_lastMouse = moved->position;
+                m_viewDirty = true;
+            }
         }
     }
 }
 
-void App::render()
+// The window's pixels as world coordinates, for inputs made for the window and the overlay.
+// getDefaultView() keeps the size the window was created with.
+static sf::View pixelView(const sf::RenderWindow& window)
 {
-    window.clear(sf::Color(25, 25, 35));
-
-    AndrewAlgorithm* andrew = dynamic_cast<AndrewAlgorithm*>(m_algorithm.get());
-    QuickHullAlgorithm* quickhull = dynamic_cast<QuickHullAlgorithm*>(m_algorithm.get());
-
-    // Classify all points by their rendering role
-    enum class PointRole {
-        INACTIVE,       // Grey - eliminated/processed
-        NORMAL,         // Light red - regular point
-        CANDIDATE,      // Yellow - being considered
-        FARTHEST,       // Green - farthest point found
-        HULL,           // Blue - on the hull
-        CURRENT         // Orange/Purple - current point being processed
-    };
-
-    std::map<Point, PointRole> pointRoles;
+    return sf::View(sf::FloatRect({0, 0}, sf::Vector2f(window.getSize())));
+}
 
-    // Initialize all points as NORMAL
+// Show all points. Inputs made for the window keep its pixel coordinates, anything else
+// is fitted into it with a margin
+void App::fitView()
+{
+    const sf::Vector2f windowSize(window.getSize());
+    if (windowSize.x <= 0 || windowSize.y <= 0) return;
+    const PointQuadtree::Rect& b = m_quadtree.bounds();
+    bool insideWindow = true;
+    float maxCoordinate = 0.0f;
     for (const Point& p : m_points) {
-        pointRoles[p] = PointRole::NORMAL;
+        insideWindow = insideWindow && p.x >= 0 && p.y >= 0 && p.x <= windowSize.x && p.y <= windowSize.y;
+        maxCoordinate = std::max({maxCoordinate, std::abs(p.x), std::abs(p.y)});
     }
 
-    // Get algorithm-specific data
-    std::vector<Point> hull = m_algorithm->getCurrentHull();
-    bool finished = m_algorithm->isFinished();
+    if (insideWindow) {
+        m_view = pixelView(window);
+    } else {
+        const float extent = std::max(b.maxX - b.minX, 1.0f) * 1.1f;
+        const float scale = extent / std::min(windowSize.x, windowSize.y);
+        m_view.setCenter({(b.minX + b.maxX) / 2, (b.minY + b.maxY) / 2});
+        m_view.setSize({windowSize.x * scale, windowSize.y * scale});
+    }
 
-    // Classify points based on algorithm state
-    if (quickhull && quickhull->hasActiveSegments()) {
-        std::set<Point> activePoints = quickhull->getActivePoints();
-        bool isPreview = quickhull->isInPreviewPhase();
+    // Floats keep about seven digits, so zooming further than a thousandth of the largest
+    // coordinate would make the points jump between pixels
+    m_minViewWidth = maxCoordinate > 0 ? maxCoordinate * 1e-3f : 1.0f;
+    m_maxViewWidth = 4.0f * std::max(m_view.getSize().x, std::max(b.maxX - b.minX, 1.0f));
+    m_viewDirty = true;
+}
 
-        // Mark inactive points
-        for (const Point& p : m_points) {
-            if (activePoints.find(p) == activePoints.end()) {
-                pointRoles[p] = PointRole::INACTIVE;
-            }
-        }
+// Zoom by factor, keeping the world position under pixel in place
+void App::zoomAt(sf::Vector2i pixel, float factor)
+{
+    const float width = m_view.getSize().x;
+    factor = std::clamp(width * factor, m_minViewWidth, m_maxViewWidth) / width;
+    if (factor == 1.0f) return;
+
+    const sf::Vector2f before = window.mapPixelToCoords(pixel, m_view);
+    m_view.zoom(factor);
+    const sf::Vector2f after = window.mapPixelToCoords(pixel, m_view);
+    m_view.move(before - after);
+    m_viewDirty = true;
+}
 
-        // Mark candidates
-        auto candidates = quickhull->getCandidatePoints();
+// The algorithm runs on the worker thread; pick up its latest state, if there is a new one
+void App::update()
+{
+    // A minimized window may report a zero size, which has no scale to draw at
+    if (window.getSize().x == 0 || window.getSize().y == 0) return;
 
-        for (const Point& p : candidates) {
-            pointRoles[p] = PointRole::CANDIDATE;
-        }
-        // Mark farthest points (only in preview)
-        if (isPreview) {
-            auto farthest = quickhull->getFarthestPoints();
-            for (const Point& p : farthest) {
-                pointRoles[p] = PointRole::FARTHEST;
-            }
-        }
+    const bool stateChanged = m_worker.updateSnapshot();
+    if (stateChanged || m_viewDirty) {
+        rebuildScene(m_worker.snapshot(), stateChanged);
+        m_viewDirty = false;
     }
+}
 
-    // Mark hull points (override previous classifications except CURRENT and FARTHEST)
-    for (const Point& p : hull) {
-        if (pointRoles[p] != PointRole::CURRENT && pointRoles[p] != PointRole::FARTHEST) {
-            pointRoles[p] = PointRole::HULL;
-        }
-    }
+void App::render()
+{
+    window.clear(sf::Color(25, 25, 35));
+    window.setView(m_view);
 
-    if (andrew && !andrew->isFinished()) {
-        pointRoles[andrew->getCurrentPoint()] = PointRole::CANDIDATE;
-    }
+    // 1. Hull edges and Chan's mini hulls (background layer)
+    window.draw(m_hullStrip);
+    window.draw(m_miniHullLines);
 
-    // === RENDERING PHASE ===
-    // 1. Draw hull edges first (background layer)
-    if (hull.size() >= 2) {
-        // Adjust loop bound only if AndrewAlgorithm is active and not finished
-        size_t end = hull.size();
-        if (andrew && !finished) {
-            end = hull.size() - 1;  // don’t close the loop yet
-        }
+    // 2. Active segments (QuickHull only)
+    window.draw(m_segmentLines);
 
-        for (size_t i = 0; i < end; i++) {
-            size_t next = (i + 1) % hull.size();
+    // 3. All points, one draw call
+    m_pointLayer.draw(window);
 
-            sf::VertexArray edge(sf::PrimitiveType::Lines, 2);
-            edge[0].position = {hull[i].x, hull[i].y};
-            edge[1].position = {hull[next].x, hull[next].y};
+    window.setView(pixelView(window));
+    drawOverlay();
+
+    window.display();
+}
 
-            sf::Color col = finished ? sf::Color(100, 150, 255)
-                                     : sf::Color(120, 180, 255);
-            edge[0].color = col;
-            edge[1].color = col;
+static sf::Vertex lineVertex(float x, float y, sf::Color color) {
+    sf::Vertex v;
+    v.position = {x, y};
+    v.color = color;
+    return v;
+}
 
-            window.draw(edge);
+// Rebuild the scene geometry from a new algorithm state or for a new view. The hull lines
+// are in world coordinates and only change with the state
+void App::rebuildScene(const SceneSnapshot& snapshot, bool stateChanged)
+{
+    const sf::Vector2f center = m_view.getCenter();
+    const sf::Vector2f size = m_view.getSize();
+    const PointQuadtree::Rect visible{center.x - size.x / 2, center.y - size.y / 2,
+                                      center.x + size.x / 2, center.y + size.y / 2};
+    const float worldPerPixel = size.x / static_cast<float>(window.getSize().x);
+    m_pointLayer.rebuild(m_quadtree, snapshot, visible, worldPerPixel);
+
+    if (stateChanged) {
+        // Hull edges as one strip; Andrew and Chan leave the loop open until they finish
+        const std::vector<Point>& hull = snapshot.hull;
+        m_hullStrip.clear();
+        if (hull.size() >= 2) {
+            const sf::Color col = snapshot.finished ? sf::Color(100, 150, 255)
+                                                    : sf::Color(120, 180, 255);
+            for (size_t i = 0; i < hull.size() + (snapshot.closedHull ? 1 : 0); i++) {
+                const Point& p = hull[i % hull.size()];
+                m_hullStrip.append(lineVertex(p.x, p.y, col));
+            }
         }
-    }
 
-    // 2. Draw active segments (QuickHull only)
-    if (quickhull && quickhull->hasActiveSegments()) {
-        auto activeSegments = quickhull->getActiveSegments();
-        for (const auto& [start, end] : activeSegments) {
-            for (float offset = -1.5f; offset <= 1.5f; offset += 0.5f) {
-                sf::VertexArray line(sf::PrimitiveType::Lines, 2);
-                line[0].position = {start.x + offset, start.y};
-                line[0].color = sf::Color(255, 100, 0, 180);
-                line[1].position = {end.x + offset, end.y};
-                line[1].color = sf::Color(255, 100, 0, 180);
-                window.draw(line);
+        // Mini hulls of the current Chan round (background, dimmed)
+        m_miniHullLines.clear();
+        for (const auto& mini : snapshot.miniHulls) {
+            if (mini.size() < 2) continue;
+
+            for (size_t i = 0; i < mini.size(); i++) {
+                const Point& a = mini[i];
+                const Point& b = mini[(i + 1) % mini.size()];
+                m_miniHullLines.append(lineVertex(a.x, a.y, sf::Color(120, 120, 140, 120)));
+                m_miniHullLines.append(lineVertex(b.x, b.y, sf::Color(120, 120, 140, 120)));
             }
         }
     }
 
-    // 3. Draw all points based on their role (render each point ONCE)
-    for (const auto& [point, role] : pointRoles) {
-        sf::CircleShape shape;
-
-        switch (role) {
-            case PointRole::INACTIVE:
-                shape.setRadius(3.5f);
-                shape.setFillColor(sf::Color(80, 80, 80));
-                shape.setOutlineColor(sf::Color(60, 60, 60));
-                shape.setOutlineThickness(0.3f);
-                shape.setPosition({point.x - 3.5f, point.y - 3.5f});
-                break;
-
-            case PointRole::NORMAL:
-                shape.setRadius(3.5f);
-                shape.setFillColor(sf::Color(200, 100, 100));
-                shape.setOutlineColor(sf::Color(150, 50, 50));
-                shape.setOutlineThickness(0.5f);
-                shape.setPosition({point.x - 3.5f, point.y - 3.5f});
-                break;
-
-            case PointRole::CANDIDATE:
-                shape.setRadius(5.5f);
-                shape.setFillColor(sf::Color(255, 200, 0));
-                shape.setOutlineColor(sf::Color(255, 255, 100));
-                shape.setOutlineThickness(1.5f);
-                shape.setPosition({point.x - 5.5f, point.y - 5.5f});
-                break;
-
-            case PointRole::FARTHEST:
-                // Draw glow first
-                {
-                    sf::CircleShape glow(12.0f);
-                    glow.setFillColor(sf::Color(0, 255, 100, 60));
-                    glow.setPosition({point.x - 12.0f, point.y - 12.0f});
-                    window.draw(glow);
-                }
-                shape.setRadius(7.0f);
-                shape.setFillColor(sf::Color(0, 255, 100));
-                shape.setOutlineColor(sf::Color(255, 255, 255));
-                shape.setOutlineThickness(2.5f);
-                shape.setPosition({point.x - 7.0f, point.y - 7.0f});
-                break;
-
-            case PointRole::HULL:
-                shape.setRadius(5.0f);
-                if (finished) {
-                    shape.setFillColor(sf::Color(80, 130, 255));
-                } else {
-                    shape.setFillColor(sf::Color(100, 160, 255));
-                }
-                shape.setOutlineColor(sf::Color::White);
-                shape.setOutlineThickness(1.5f);
-                shape.setPosition({point.x - 5.0f, point.y - 5.0f});
-                break;
-
-            case PointRole::CURRENT:
-                shape.setRadius(6.0f);
-                shape.setOutlineColor(sf::Color::White);
-                shape.setOutlineThickness(3.0f);
-                shape.setPosition({point.x - 6.0f, point.y - 6.0f});
-                break;
+    // Active segments, drawn several times side by side for a thicker line
+    m_segmentLines.clear();
+    for (const auto& [start, end] : snapshot.segments) {
+        for (float pixels = -1.5f; pixels <= 1.5f; pixels += 0.5f) {
+            const float offset = pixels * worldPerPixel;
+            m_segmentLines.append(lineVertex(start.x + offset, start.y, sf::Color(255, 100, 0, 180)));
+            m_segmentLines.append(lineVertex(end.x + offset, end.y, sf::Color(255, 100, 0, 180)));
         }
-
-        window.draw(shape);
     }
-
-    drawOverlay();
-
-    window.display();
 }
 
 void App::drawOverlay() {
@@ -286,8 +307,11 @@ void App::drawOverlay() {
     const char* controls[] = {
         "Controls",
         "Enter = Show whole algorithm",
+        "+/- = Autoplay speed",
         "Space = Step through algorithm",
         "R = Reset algorithm",
+        "Wheel = Zoom, Drag = Pan",
+        "F = Fit view",
         "Esc = Quit visualization",
         "H = Toggle help"
     };
@@ -381,8 +405,7 @@ void App::loadUiFont() {
 void App::selectAlgorithm(int idx) {
     if (idx < 0 || idx >= static_cast<int>(m_algoMakers.size())) return;
     m_algoIndex = idx;
-    m_algorithm = m_algoMakers[m_algoIndex]();
-    m_algorithm->reset(m_points);
+    m_worker.select(m_algoMakers[m_algoIndex]);
 }
 
 
@@ -3,7 +3,11 @@
 
 #include <SFML/Graphics.hpp>
 #include "../point_providers/Point.h"
+#include "../point_providers/PointQuadtree.h"
 #include "../algorithms/IAlgorithm.h"
+#include "AlgorithmWorker.h"
+#include "PointLayer.h"
+#include "SceneSnapshot.h"
 #include <functional>
 
 class App {
@@ -18,14 +22,37 @@ public:
     void setAlgorithms(std::vector<std::string> names,
                    std::vector<std::function<std::unique_ptr<IAlgorithm>()>> makers,
                    int initialIndex = 0);
+    void setStepsPerSecond(double stepsPerSecond);
 
 private:
     sf::RenderWindow window;
     unsigned int m_frameLimit;
     std::vector<Point> m_points;
-    std::unique_ptr<IAlgorithm> m_algorithm;
+    PointQuadtree m_quadtree;
+    AlgorithmWorker m_worker;
     bool m_autoPlay = false;
-    int m_frameCounter = 0;
+    double m_stepsPerSecond = 6.0;
+
+    static constexpr double MIN_STEPS_PER_SECOND = 0.5;
+    static constexpr double MAX_STEPS_PER_SECOND = 10000.0;
+
+    // World region on screen; zoomed with the wheel, panned by dragging
+    sf::View m_view;
+    sf::Vector2u m_windowSize;
+    bool m_viewDirty = true;
+    bool m_dragging = false;
+    sf::Vector2i m_lastMouse;
+    float m_minViewWidth = 1.0f;
+    float m_maxViewWidth = 1.0f;
+
+    // Scene geometry, rebuilt only when the worker published a new state or the view moved
+    PointLayer m_pointLayer;
+    sf::VertexArray m_hullStrip{sf::PrimitiveType::LineStrip};
+    sf::VertexArray m_miniHullLines{sf::PrimitiveType::Lines};
+    sf::VertexArray m_segmentLines{sf::PrimitiveType::Lines};
+
+    sf::Clock m_frameClock;
+    unsigned int m_framesCounted = 0;
 
     sf::Font m_uiFont;
     bool m_fontLoaded = false;
@@ -34,6 +61,11 @@ private:
     void processEvents();
     void update();
     void render();
+    void updateFrameRate();
+    void rebuildScene(const SceneSnapshot& snapshot, bool stateChanged);
+
+    void fitView();
+    void zoomAt(sf::Vector2i pixel, float factor);
 
     void drawOverlay();
     void loadUiFont();
@@ -0,0 +1,157 @@
+#include "PointLayer.h"
+#include <algorithm>
+#include <cmath>
+
+constexpr unsigned DISK_SIZE = 32;
+// Screen size the quadtree is refined to, and the most points a cell may hold to be
+// drawn point by point
+constexpr float CELL_PIXELS = 6.0f;
+constexpr std::size_t INDIVIDUAL_LIMIT = 2;
+
+// Outer radius in pixels (fill plus outline) and fill color of each role
+static float roleRadius(PointRole role) {
+    switch (role) {
+        case PointRole::INACTIVE:  return 3.8f;
+        case PointRole::NORMAL:    return 4.0f;
+        case PointRole::CANDIDATE: return 7.0f;
+        case PointRole::FARTHEST:  return 9.5f;
+        case PointRole::HULL:      return 6.5f;
+        default:                   return 9.0f;
+    }
+}
+
+static sf::Color roleColor(PointRole role, bool finished) {
+    switch (role) {
+        case PointRole::INACTIVE:  return sf::Color(80, 80, 80);
+        case PointRole::NORMAL:    return sf::Color(200, 100, 100);
+        case PointRole::CANDIDATE: return sf::Color(255, 200, 0);
+        case PointRole::FARTHEST:  return sf::Color(0, 255, 100);
+        case PointRole::HULL:      return finished ? sf::Color(80, 130, 255) : sf::Color(100, 160, 255);
+        default:                   return sf::Color::White;
+    }
+}
+
+// White disk with a darker rim and a smooth edge; the vertex color tints it, so the rim
+// stands in for the outline the circle shapes had
+static sf::Image makeDisk() {
+    sf::Image image({DISK_SIZE, DISK_SIZE}, sf::Color::Transparent);
+    const float c = DISK_SIZE / 2.0f;
+    for (unsigned y = 0; y < DISK_SIZE; y++) {
+        for (unsigned x = 0; x < DISK_SIZE; x++) {
+            const float r = std::hypot(x + 0.5f - c, y + 0.5f - c) / c;
+            const float alpha = std::clamp((1.0f - r) * c, 0.0f, 1.0f);
+            const std::uint8_t shade = r < 0.75f ? 255 : 170;
+            image.setPixel({x, y}, sf::Color(shade, shade, shade, static_cast<std::uint8_t>(alpha * 255)));
+        }
+    }
+    return image;
+}
+
+PointLayer::PointLayer() {
+    if (m_disk.loadFromImage(makeDisk())) {
+        m_disk.setSmooth(true);
+    }
+}
+
+void PointLayer::setPoints(const std::vector<Point>& points) {
+    m_points = points;
+    m_vertices.clear();
+}
+
+void PointLayer::rebuild(const PointQuadtree& tree, const SceneSnapshot& snapshot, const PointQuadtree::Rect& view,
+                         float worldPerPixel) {
+    m_vertices.clear();
+    if (snapshot.roles.size() != m_points.size() || snapshot.hullBefore.size() != tree.size() + 1) {
+        return;
+    }
+
+    // Extend the view by the largest point radius, so points just outside still show
+    const float margin = roleRadius(PointRole::FARTHEST) * worldPerPixel;
+    const PointQuadtree::Rect padded{view.minX - margin, view.minY - margin, view.maxX + margin, view.maxY + margin};
+    const float cellSize = CELL_PIXELS * worldPerPixel;
+
+    tree.query(padded, cellSize, [&](const PointQuadtree::Cell& cell) {
+        // Cells still larger than cellSize are leaves, zoomed in beyond the grid resolution
+        const std::size_t count = cell.end - cell.begin;
+        if (count <= INDIVIDUAL_LIMIT || cell.bounds.maxX - cell.bounds.minX > cellSize) {
+            for (std::size_t k = cell.begin; k < cell.end; k++) {
+                const std::uint32_t i = tree.order()[k];
+                appendDisk(m_points[i], snapshot.roles[i], snapshot.finished, worldPerPixel);
+            }
+            return;
+        }
+
+        // Density cell: the color of its most interesting role, more opaque the more
+        // points it holds
+        auto inCell = [&](const std::vector<std::uint32_t>& before) { return before[cell.end] - before[cell.begin]; };
+        const std::size_t farthest = inCell(snapshot.farthestBefore);
+        const std::size_t hull = inCell(snapshot.hullBefore);
+        const std::size_t candidates = inCell(snapshot.candidatesBefore);
+        const std::size_t inactive = inCell(snapshot.inactiveBefore);
+        const PointRole role = farthest > 0                                     ? PointRole::FARTHEST
+                               : hull > 0                                       ? PointRole::HULL
+                               : candidates > 0                                 ? PointRole::CANDIDATE
+                               : farthest + hull + candidates + inactive < count ? PointRole::NORMAL
+                                                                                : PointRole::INACTIVE;
+        // Refined cells are over half of cellSize wide; a smaller one is all of a tiny
+        // cluster, down to identical points, and shows as one of its points
+        if (cell.bounds.maxX - cell.bounds.minX <= cellSize / 2) {
+            appendDisk(m_points[tree.order()[cell.begin]], role, snapshot.finished, worldPerPixel);
+            return;
+        }
+        sf::Color color = roleColor(role, snapshot.finished);
+        color.a = static_cast<std::uint8_t>(std::min(255.0f, 90.0f + 30.0f * std::log2(static_cast<float>(count))));
+        appendQuad(cell.bounds.minX, cell.bounds.minY, cell.bounds.maxX, cell.bounds.maxY, color, false);
+    });
+
+    // The current point stays visible on top of the density cells
+    for (const auto& [p, role] : snapshot.markers) {
+        if (p.x >= padded.minX && p.x <= padded.maxX && p.y >= padded.minY && p.y <= padded.maxY) {
+            appendDisk(p, role, snapshot.finished, worldPerPixel);
+        }
+    }
+
+    // One upload per rebuild; the frames in between draw from the GPU copy
+    const std::size_t count = m_vertices.getVertexCount();
+    m_useBuffer = sf::VertexBuffer::isAvailable();
+    if (m_useBuffer && count > 0) {
+        if (m_buffer.getVertexCount() < count) {
+            m_useBuffer = m_buffer.create(count);
+        }
+        m_useBuffer = m_useBuffer && m_buffer.update(&m_vertices[0], count, 0);
+    }
+}
+
+void PointLayer::draw(sf::RenderTarget& target) const {
+    sf::RenderStates states;
+    states.texture = &m_disk;
+    if (m_useBuffer) {
+        target.draw(m_buffer, 0, m_vertices.getVertexCount(), states);
+    } else {
+        target.draw(m_vertices, states);
+    }
+}
+
+void PointLayer::appendDisk(const Point& p, PointRole role, bool finished, float worldPerPixel) {
+    if (role == PointRole::FARTHEST) {
+        const float glow = 12.0f * worldPerPixel;
+        appendQuad(p.x - glow, p.y - glow, p.x + glow, p.y + glow, sf::Color(0, 255, 100, 60), true);
+    }
+    const float r = roleRadius(role) * worldPerPixel;
+    appendQuad(p.x - r, p.y - r, p.x + r, p.y + r, roleColor(role, finished), true);
+}
+
+// Two triangles; untextured quads sample the opaque center of the disk
+void PointLayer::appendQuad(float minX, float minY, float maxX, float maxY, sf::Color color, bool textured) {
+    const float size = static_cast<float>(DISK_SIZE);
+    const float center = size / 2;
+    const sf::Vector2f corners[6] = {{minX, minY}, {maxX, minY}, {maxX, maxY}, {minX, minY}, {maxX, maxY}, {minX, maxY}};
+    const sf::Vector2f texCoords[6] = {{0, 0}, {size, 0}, {size, size}, {0, 0}, {size, size}, {0, size}};
+    for (std::size_t k = 0; k < 6; k++) {
+        sf::Vertex v;
+        v.position = corners[k];
+        v.color = color;
+        v.texCoords = textured ? texCoords[k] : sf::Vector2f(center, center);
+        m_vertices.append(v);
+    }
+}
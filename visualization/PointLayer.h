@@ -0,0 +1,40 @@
+#ifndef POINTLAYER_H
+#define POINTLAYER_H
+
+#include <SFML/Graphics.hpp>
+#include "../point_providers/Point.h"
+#include "../point_providers/PointQuadtree.h"
+#include "SceneSnapshot.h"
+#include <vector>
+
+// The points visible in a view, drawn as textured quads out of one vertex array with a
+// single call. rebuild() walks the quadtree down to cells of a few pixels: a cell holding
+// one or two points shows them with their roles, a denser one becomes a single density
+// quad colored by the roles inside it, so the vertex count follows the visible cells,
+// not the number of points. The result is uploaded to a vertex buffer where available
+// and redrawn from it until the next rebuild.
+class PointLayer {
+public:
+    PointLayer();
+
+    void setPoints(const std::vector<Point>& points);
+
+    // worldPerPixel converts the on-screen sizes of points and cells to world units
+    void rebuild(const PointQuadtree& tree, const SceneSnapshot& snapshot, const PointQuadtree::Rect& view,
+                 float worldPerPixel);
+
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    std::vector<Point> m_points;
+
+    sf::VertexArray m_vertices{sf::PrimitiveType::Triangles};
+    sf::VertexBuffer m_buffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Dynamic};
+    bool m_useBuffer = false;
+    sf::Texture m_disk;
+
+    void appendDisk(const Point& p, PointRole role, bool finished, float worldPerPixel);
+    void appendQuad(float minX, float minY, float maxX, float maxY, sf::Color color, bool textured);
+};
+
+#endif
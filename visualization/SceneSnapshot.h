@@ -0,0 +1,37 @@
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+
+#include "../point_providers/Point.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Rendering role of a point
+enum class PointRole : std::uint8_t {
+    INACTIVE,       // Grey - eliminated/processed
+    NORMAL,         // Light red - regular point
+    CANDIDATE,      // Yellow - being considered
+    FARTHEST,       // Green - farthest point found
+    HULL,           // Blue - on the hull
+    CURRENT         // White - current point being processed
+};
+
+// Everything the renderer needs from one algorithm state
+struct SceneSnapshot {
+    std::vector<PointRole> roles;            // indexed like the input points
+    // Number of points of each role among the first k points of the quadtree order, so
+    // the mix of roles in any cell is a few lookups; NORMAL is what the others leave
+    std::vector<std::uint32_t> inactiveBefore;
+    std::vector<std::uint32_t> candidatesBefore;
+    std::vector<std::uint32_t> farthestBefore;
+    std::vector<std::uint32_t> hullBefore;
+    // The current point of Andrew or Chan, drawn on top at any zoom
+    std::vector<std::pair<Point, PointRole>> markers;
+    std::vector<Point> hull;
+    bool finished = false;
+    bool closedHull = false;                 // Andrew and Chan leave the loop open until they finish
+    std::vector<std::pair<Point, Point>> segments;
+    std::vector<std::vector<Point>> miniHulls;
+};
+
+#endif
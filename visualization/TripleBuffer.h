@@ -0,0 +1,46 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Lock-free hand-over of values from one writer thread to one reader thread. The writer
+// fills back() and publishes it; the reader picks up the latest published value with
+// update() and reads it through front() while the writer goes on with the third slot.
+// Slots are reused, so containers inside T keep their capacity between frames.
+template <class T>
+class TripleBuffer {
+public:
+    // Writer side
+    T& back() { return m_slots[m_back]; }
+
+    void publish() {
+        const std::uint8_t previous = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel);
+        m_back = previous & INDEX;
+    }
+
+    // Reader side: returns false, keeping the current front, when nothing new was published
+    bool update() {
+        if (!(m_middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        const std::uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX;
+        return true;
+    }
+
+    const T& front() const { return m_slots[m_front]; }
+
+private:
+    // The middle slot's index, plus a flag set while it holds a value the reader has not seen
+    static constexpr std::uint8_t INDEX = 3;
+    static constexpr std::uint8_t FRESH = 4;
+
+    std::array<T, 3> m_slots{};
+    std::uint8_t m_front = 0;
+    std::atomic<std::uint8_t> m_middle{1};
+    std::uint8_t m_back = 2;
+};
+
+#endif